@@ -37,7 +37,7 @@ extension Encryptor {
     // Encrypt input hex string and return encrypted string in hex format
     func encrypt(hex: String) -> String {
       if let aes = aes {
-        let inputBytes = [UInt8].init(hex: hex)
+        let inputBytes = Hex.toBytes(hex)
         let encrypted = try! aes.encrypt(inputBytes)
         return Data(bytes: encrypted).tk_toHexString()
       } else {
@@ -48,7 +48,7 @@ extension Encryptor {
     // Decrypt input hex string and return decrypted string in hex format
     func decrypt(hex: String) -> String {
       if let aes = aes {
-        let inputBytes = [UInt8].init(hex: hex)
+        let inputBytes = Hex.toBytes(hex)
         let decrypted = try! aes.decrypt(inputBytes)
         return Data(bytes: decrypted).tk_toHexString()
       } else {
@@ -57,8 +57,8 @@ extension Encryptor {
     }
 
     private var aes: AES? {
-      let keyBytes = [UInt8].init(hex: key)
-      let ivBytes = [UInt8].init(hex: iv)
+      let keyBytes = Hex.toBytes(key)
+      let ivBytes = Hex.toBytes(iv)
 
       return try? AES(key: keyBytes, blockMode: blockMode(iv: ivBytes), padding: self.padding)
     }
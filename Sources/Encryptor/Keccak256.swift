@@ -19,7 +19,13 @@ public extension Encryptor {
     }
 
     public func encrypt(data: Data) -> String {
-      return SHA3(variant: .keccak256).calculate(for: data.bytes).toHexString()
+      return Hex.hex(from: calculate(for: data.bytes))
+    }
+
+    func calculate(for bytes: [UInt8]) -> [UInt8] {
+      var hash = [UInt8](repeating: 0, count: 32)
+      tk_keccak256(bytes, bytes.count, &hash)
+      return hash
     }
   }
 }
@@ -26,7 +26,7 @@ extension Encryptor {
 
       // Encrypt input string and return encrypted string in hex format.
       func encrypt() -> String {
-        let saltBytes = [UInt8](hex: salt)
+        let saltBytes = Hex.toBytes(salt)
         let passwordBytes = password.data(using: .utf8)!.bytes
         if let pbkdf2 = try? PKCS5.PBKDF2(password: passwordBytes, salt: saltBytes, iterations: iterations, keyLength: keyLength) {
           if let encrypted = try? pbkdf2.calculate() {
@@ -38,3 +38,63 @@ extension Encryptor {
       }
   }
 }
+
+extension Encryptor.PBKDF2 {
+  /// PBKDF2-HMAC-SHA512, as BIP39 uses to derive seed from mnemonic.
+  /// HMAC ipad/opad midstates are computed once, every further iteration costs two SHA-512 compressions.
+  static func hmacSHA512(password: [UInt8], salt: [UInt8], iterations: Int, keyLength: Int = Encryptor.SHA512.digestSize) -> [UInt8] {
+    typealias SHA512 = Encryptor.SHA512
+
+    var key = password.count > SHA512.blockSize ? SHA512.hash(password) : password
+    key += [UInt8](repeating: 0, count: SHA512.blockSize - key.count)
+    let innerState = midstate(key.map { $0 ^ 0x36 })
+    let outerState = midstate(key.map { $0 ^ 0x5c })
+
+    // Block of a 64 bytes message following the ipad/opad block: message, padding and total bit length.
+    var block = [UInt64](repeating: 0, count: SHA512.blockWords)
+    block[SHA512.stateWords] = 0x8000_0000_0000_0000
+    block[SHA512.blockWords - 1] = UInt64(SHA512.blockSize + SHA512.digestSize) << 3
+    var schedule = [UInt64](repeating: 0, count: SHA512.scheduleWords)
+    var state = [UInt64](repeating: 0, count: SHA512.stateWords)
+
+    var derivedKey = [UInt8]()
+    var blockIndex: UInt32 = 1
+    while derivedKey.count < keyLength {
+      let indexBytes = (0..<4).map { UInt8(truncatingIfNeeded: blockIndex >> UInt32(24 - $0 * 8)) }
+      let innerDigest = SHA512.hash(salt + indexBytes, from: innerState, prefixLength: SHA512.blockSize)
+      var u = SHA512.hash(SHA512.bytes(of: innerDigest), from: outerState, prefixLength: SHA512.blockSize)
+      var t = u
+
+      for _ in 1..<max(iterations, 1) {
+        for i in 0..<SHA512.stateWords {
+          block[i] = u[i]
+        }
+        state.replaceSubrange(0..<SHA512.stateWords, with: innerState)
+        SHA512.compress(&state, block: block, schedule: &schedule)
+
+        for i in 0..<SHA512.stateWords {
+          block[i] = state[i]
+        }
+        state.replaceSubrange(0..<SHA512.stateWords, with: outerState)
+        SHA512.compress(&state, block: block, schedule: &schedule)
+
+        for i in 0..<SHA512.stateWords {
+          u[i] = state[i]
+          t[i] ^= state[i]
+        }
+      }
+
+      derivedKey += SHA512.bytes(of: t)
+      blockIndex += 1
+    }
+    return Array(derivedKey.prefix(keyLength))
+  }
+
+  private static func midstate(_ paddedKey: [UInt8]) -> [UInt64] {
+    var state = Encryptor.SHA512.initialState
+    var schedule = [UInt64](repeating: 0, count: Encryptor.SHA512.scheduleWords)
+    let block = (0..<Encryptor.SHA512.blockWords).map { Encryptor.SHA512.word(paddedKey, at: $0 * 8) }
+    Encryptor.SHA512.compress(&state, block: block, schedule: &schedule)
+    return state
+  }
+}
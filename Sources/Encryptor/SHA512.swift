@@ -0,0 +1,134 @@
+//
+//  SHA512.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+extension Encryptor {
+  /// SHA-512 on big endian 64-bit words (FIPS 180-4).
+  /// The compression function is exposed so HMAC can resume from precomputed ipad/opad midstates.
+  enum SHA512 {
+    static let blockSize = 128
+    static let digestSize = 64
+    static let blockWords = 16
+    static let stateWords = 8
+    static let scheduleWords = 80
+
+    static let initialState: [UInt64] = [
+      0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+      0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+    ]
+
+    private static let k: [UInt64] = [
+      0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538,
+      0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 0x12835b0145706fbe,
+      0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+      0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+      0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 0x983e5152ee66dfab,
+      0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+      0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed,
+      0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+      0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+      0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+      0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373,
+      0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+      0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, 0xca273eceea26619c,
+      0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+      0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+      0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+    ]
+
+    static func hash(_ message: [UInt8]) -> [UInt8] {
+      return bytes(of: hash(message, from: initialState, prefixLength: 0))
+    }
+
+    /// Hash the message as the tail of a longer one, whose first prefixLength bytes (whole blocks)
+    /// have already been compressed into state.
+    static func hash(_ message: [UInt8], from state: [UInt64], prefixLength: Int) -> [UInt64] {
+      var padded = message
+      padded.append(0x80)
+      while padded.count % blockSize != blockSize - 16 {
+        padded.append(0)
+      }
+      let bitLength = UInt64(prefixLength + message.count) << 3
+      padded += [UInt8](repeating: 0, count: 8) + bytes(of: [bitLength])
+
+      var result = state
+      var block = [UInt64](repeating: 0, count: blockWords)
+      var schedule = [UInt64](repeating: 0, count: scheduleWords)
+      for offset in stride(from: 0, to: padded.count, by: blockSize) {
+        for i in 0..<blockWords {
+          block[i] = word(padded, at: offset + i * 8)
+        }
+        compress(&result, block: block, schedule: &schedule)
+      }
+      return result
+    }
+
+    /// Compress one block of 16 words into the state.
+    /// Schedule is scratch space of 80 words, so that hot loops don't allocate.
+    static func compress(_ state: UnsafeMutablePointer<UInt64>, block: UnsafePointer<UInt64>, schedule w: UnsafeMutablePointer<UInt64>) {
+      for t in 0..<blockWords {
+        w[t] = block[t]
+      }
+      for t in blockWords..<scheduleWords {
+        let s0 = rotr(w[t - 15], 1) ^ rotr(w[t - 15], 8) ^ (w[t - 15] >> 7)
+        let s1 = rotr(w[t - 2], 19) ^ rotr(w[t - 2], 61) ^ (w[t - 2] >> 6)
+        w[t] = w[t - 16] &+ s0 &+ w[t - 7] &+ s1
+      }
+
+      var a = state[0], b = state[1], c = state[2], d = state[3]
+      var e = state[4], f = state[5], g = state[6], h = state[7]
+      k.withUnsafeBufferPointer { k in
+        for t in 0..<scheduleWords {
+          let t1 = h &+ (rotr(e, 14) ^ rotr(e, 18) ^ rotr(e, 41)) &+ ((e & f) ^ (~e & g)) &+ k[t] &+ w[t]
+          let t2 = (rotr(a, 28) ^ rotr(a, 34) ^ rotr(a, 39)) &+ ((a & b) ^ (a & c) ^ (b & c))
+          h = g
+          g = f
+          f = e
+          e = d &+ t1
+          d = c
+          c = b
+          b = a
+          a = t1 &+ t2
+        }
+      }
+
+      state[0] = state[0] &+ a
+      state[1] = state[1] &+ b
+      state[2] = state[2] &+ c
+      state[3] = state[3] &+ d
+      state[4] = state[4] &+ e
+      state[5] = state[5] &+ f
+      state[6] = state[6] &+ g
+      state[7] = state[7] &+ h
+    }
+
+    static func bytes(of words: [UInt64]) -> [UInt8] {
+      var output = [UInt8](repeating: 0, count: words.count * 8)
+      for (i, word) in words.enumerated() {
+        for j in 0..<8 {
+          output[i * 8 + j] = UInt8(truncatingIfNeeded: word >> UInt64(56 - j * 8))
+        }
+      }
+      return output
+    }
+
+    static func word(_ bytes: [UInt8], at offset: Int) -> UInt64 {
+      var value: UInt64 = 0
+      for i in 0..<8 {
+        value = value << 8 | UInt64(bytes[offset + i])
+      }
+      return value
+    }
+
+    @inline(__always)
+    private static func rotr(_ x: UInt64, _ n: UInt64) -> UInt64 {
+      return (x >> n) | (x << (64 - n))
+    }
+  }
+}
@@ -26,33 +26,12 @@ extension Encryptor {
     /// - Parameter message: Message in hex format.
     /// - Returns: Signature as a `SignResult`.
     func sign(key: String, message: String) -> SignResult {
-      guard let keyBytes = key.tk_dataFromHexString()?.bytes,
+      guard let signer = Signer(key: key),
         let messageBytes = message.tk_dataFromHexString()?.bytes else {
           return  Secp256k1.failureSignResult
       }
 
-      let context = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY))!
-      defer {
-        secp256k1_context_destroy(context)
-      }
-
-      if secp256k1_ec_seckey_verify(context, keyBytes) != 1 {
-        return Secp256k1.failureSignResult
-      }
-
-      var sig = secp256k1_ecdsa_recoverable_signature()
-
-      if secp256k1_ecdsa_sign_recoverable(context, &sig, messageBytes, keyBytes, secp256k1_nonce_function_rfc6979, nil) == 0 {
-        return Secp256k1.failureSignResult
-      }
-
-      var data = Data(count: signatureLength)
-      var recid: Int32 = 0
-      data.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) in
-        _ = secp256k1_ecdsa_recoverable_signature_serialize_compact(context, bytes, &recid, &sig)
-      }
-
-      return SignResult(signature: data.tk_toHexString(), recid: recid)
+      return signer.sign(hash: messageBytes)
     }
 
     /// Recover public key from signature and message.
@@ -66,33 +45,7 @@ extension Encryptor {
           return nil
       }
 
-      let context = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY))!
-      defer {
-        secp256k1_context_destroy(context)
-      }
-
-      var sig = secp256k1_ecdsa_recoverable_signature()
-      secp256k1_ecdsa_recoverable_signature_parse_compact(context, &sig, signBytes, recid)
-
-      var publicKey = secp256k1_pubkey()
-      var result: Int32 = 0
-      result = secp256k1_ecdsa_recover(context, &publicKey, &sig, messageBytes)
-
-      if result == 0 {
-        return nil
-      }
-
-      var length = 65
-      var data = Data(count: length)
-      data.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) in
-        result = secp256k1_ec_pubkey_serialize(context, bytes, &length, &publicKey, UInt32(SECP256K1_EC_UNCOMPRESSED))
-      }
-
-      if result == 0 {
-        return nil
-      }
-
-      return data.toHexString()
+      return Recoverer.shared.recover(hash: messageBytes, signature: signBytes, recid: recid).map { Hex.hex(from: $0) }
     }
     
     /// Recover public key from signature and message.
@@ -101,40 +54,7 @@ extension Encryptor {
     /// - Parameter recid: recid.
     /// - Returns: Recoverd public key.
     func eosRecover(signature: Data, message: Data, recid: Int32) -> String? {
-//      guard let signBytes = signature.tk_dataFromHexString()?.bytes,
-//        let messageBytes = message.tk_dataFromHexString()?.bytes else {
-//          return nil
-//      }
-      let signBytes = signature.bytes
-      let messageBytes = message.bytes
-      
-      let context = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY))!
-      defer {
-        secp256k1_context_destroy(context)
-      }
-      
-      var sig = secp256k1_ecdsa_recoverable_signature()
-      secp256k1_ecdsa_recoverable_signature_parse_compact(context, &sig, signBytes, recid)
-      
-      var publicKey = secp256k1_pubkey()
-      var result: Int32 = 0
-      result = secp256k1_ecdsa_recover(context, &publicKey, &sig, messageBytes)
-      
-      if result == 0 {
-        return nil
-      }
-      
-      var length = 65
-      var data = Data(count: length)
-      data.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) in
-        result = secp256k1_ec_pubkey_serialize(context, bytes, &length, &publicKey, UInt32(SECP256K1_EC_UNCOMPRESSED))
-      }
-      
-      if result == 0 {
-        return nil
-      }
-      
-      return data.toHexString()
+      return Recoverer.shared.recover(hash: message.bytes, signature: signature.bytes, recid: recid).map { Hex.hex(from: $0) }
     }
     
 
@@ -160,3 +80,247 @@ extension Encryptor {
     }
   }
 }
+
+extension Encryptor.Secp256k1 {
+  private static let publicKeyContext = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_SIGN))!
+
+  /// Public key of a 32 bytes private key, 65 bytes uncompressed or 33 bytes compressed.
+  /// - Returns: nil if the key is not a valid secp256k1 private key.
+  static func publicKey(of privateKey: [UInt8], compressed: Bool = false) -> [UInt8]? {
+    guard privateKey.count == 32 else {
+      return nil
+    }
+
+    var publicKey = secp256k1_pubkey()
+    guard secp256k1_ec_pubkey_create(publicKeyContext, &publicKey, privateKey) == 1 else {
+      return nil
+    }
+
+    var length = compressed ? 33 : 65
+    var output = [UInt8](repeating: 0, count: length)
+    let flags = compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED
+    guard secp256k1_ec_pubkey_serialize(publicKeyContext, &output, &length, &publicKey, UInt32(flags)) == 1 else {
+      return nil
+    }
+    return output
+  }
+
+  /// privateKey + tweak modulo the curve order, the private key step of BIP32 child derivation.
+  /// - Returns: nil if tweak is not below the curve order or the sum is zero.
+  static func privateKey(_ privateKey: [UInt8], adding tweak: [UInt8]) -> [UInt8]? {
+    guard privateKey.count == 32 && tweak.count == 32 else {
+      return nil
+    }
+
+    var result = privateKey
+    guard secp256k1_ec_privkey_tweak_add(publicKeyContext, &result, tweak) == 1 else {
+      return nil
+    }
+    return result
+  }
+}
+
+extension Encryptor.Secp256k1 {
+  /// Holds one context and a verified private key, to sign many hashes with the same key.
+  final class Signer {
+    private let context: OpaquePointer
+    private var key: [UInt8]
+    private let signatureLength = 64
+    /// Fewest hashes worth a chunk of their own when signing concurrently.
+    static let minimumChunkSize = 16
+
+    /// - Parameter key: Key in hex format.
+    /// - Returns: nil if the key is not a valid secp256k1 private key.
+    init?(key: String) {
+      guard let keyBytes = key.tk_dataFromHexString()?.bytes, keyBytes.count == 32 else {
+        return nil
+      }
+
+      let context = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_SIGN))!
+      if secp256k1_ec_seckey_verify(context, keyBytes) != 1 {
+        secp256k1_context_destroy(context)
+        return nil
+      }
+      self.context = context
+      self.key = keyBytes
+    }
+
+    deinit {
+      for i in 0..<key.count {
+        key[i] = 0
+      }
+      secp256k1_context_destroy(context)
+    }
+
+    /// Sign a 32 bytes hash.
+    func sign(hash: [UInt8]) -> SignResult {
+      guard hash.count == 32 else {
+        return Secp256k1.failureSignResult
+      }
+
+      var data = Data(count: signatureLength)
+      let recid = data.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) in
+        return signCompact(hash: hash, output: bytes)
+      }
+      guard let signedRecid = recid else {
+        return Secp256k1.failureSignResult
+      }
+
+      return SignResult(signature: data.tk_toHexString(), recid: signedRecid)
+    }
+
+    /// Sign 32 bytes hashes laid out back to back.
+    /// - Parameter hashes: count * 32 bytes.
+    /// - Parameter concurrently: Split hashes into chunks signed across cores.
+    /// - Returns: count * 65 bytes of r, s and v (recid + 27) for each hash, nil if hashes are malformed or any signing fails.
+    func signPacked(hashes: [UInt8], concurrently: Bool = false) -> [UInt8]? {
+      guard hashes.count % 32 == 0 else {
+        return nil
+      }
+
+      let count = hashes.count / 32
+      var output = [UInt8](repeating: 0, count: count * 65)
+      var failed = false
+      hashes.withUnsafeBufferPointer { hashesBuffer in
+        output.withUnsafeMutableBufferPointer { outputBuffer in
+          let hashesBase = hashesBuffer.baseAddress!
+          let outputBase = outputBuffer.baseAddress!
+          // Each chunk writes its own range of output, context is only read while signing
+          let signRange = { (range: Range<Int>) -> Bool in
+            for i in range {
+              guard let recid = self.signCompact(hash: hashesBase + i * 32, output: outputBase + i * 65) else {
+                return false
+              }
+              outputBase[i * 65 + 64] = UInt8(recid + 27)
+            }
+            return true
+          }
+
+          let chunks = concurrently ? min(count / Signer.minimumChunkSize, ProcessInfo.processInfo.activeProcessorCount) : 1
+          if chunks <= 1 {
+            failed = !signRange(0..<count)
+            return
+          }
+          let chunkSize = (count + chunks - 1) / chunks
+          let failedLock = NSLock()
+          DispatchQueue.concurrentPerform(iterations: chunks) { chunk in
+            let range = (chunk * chunkSize)..<min(count, (chunk + 1) * chunkSize)
+            if !signRange(range) {
+              failedLock.lock()
+              failed = true
+              failedLock.unlock()
+            }
+          }
+        }
+      }
+
+      return failed ? nil : output
+    }
+
+    /// Write 64 bytes compact signature of the 32 bytes hash, and return recid.
+    private func signCompact(hash: UnsafePointer<UInt8>, output: UnsafeMutablePointer<UInt8>) -> Int32? {
+      var sig = secp256k1_ecdsa_recoverable_signature()
+      if secp256k1_ecdsa_sign_recoverable(context, &sig, hash, key, secp256k1_nonce_function_rfc6979, nil) == 0 {
+        return nil
+      }
+
+      var recid: Int32 = 0
+      _ = secp256k1_ecdsa_recoverable_signature_serialize_compact(context, output, &recid, &sig)
+      return recid
+    }
+  }
+}
+
+extension Encryptor.Secp256k1 {
+  /// Holds one verify context to recover public keys of many signatures.
+  /// Context is only read while recovering, so one recoverer serves any number of threads.
+  final class Recoverer {
+    static let shared = Recoverer()
+    /// Fewest signatures worth a chunk of their own when recovering concurrently.
+    static let minimumChunkSize = 16
+
+    private let context: OpaquePointer
+
+    init() {
+      context = secp256k1_context_create(UInt32(SECP256K1_CONTEXT_VERIFY))!
+    }
+
+    deinit {
+      secp256k1_context_destroy(context)
+    }
+
+    /// Recover uncompressed public key (65 bytes) of a 64 bytes compact signature of a 32 bytes hash.
+    func recover(hash: [UInt8], signature: [UInt8], recid: Int32) -> [UInt8]? {
+      guard hash.count == 32 && signature.count == 64 else {
+        return nil
+      }
+
+      var publicKey = [UInt8](repeating: 0, count: 65)
+      let recovered = publicKey.withUnsafeMutableBufferPointer { buffer in
+        return recover(hash: hash, signature: signature, recid: recid, compressed: false, output: buffer.baseAddress!)
+      }
+      return recovered ? publicKey : nil
+    }
+
+    /// Recover public keys of signatures laid out back to back.
+    /// - Parameter hashes: count * 32 bytes.
+    /// - Parameter signatures: count * 64 bytes compact signatures.
+    /// - Parameter recids: count recids.
+    /// - Parameter compressed: Output 33 bytes compressed instead of 65 bytes uncompressed public keys.
+    /// - Parameter concurrently: Split signatures into chunks recovered across cores.
+    /// - Returns: count public keys back to back, a key that fails to recover is left zero filled. nil if lengths don't match.
+    func recoverPacked(hashes: [UInt8], signatures: [UInt8], recids: [Int32], compressed: Bool = false, concurrently: Bool = false) -> [UInt8]? {
+      let count = recids.count
+      guard hashes.count == count * 32 && signatures.count == count * 64 else {
+        return nil
+      }
+
+      let keyLength = compressed ? 33 : 65
+      var output = [UInt8](repeating: 0, count: count * keyLength)
+      hashes.withUnsafeBufferPointer { hashesBuffer in
+        signatures.withUnsafeBufferPointer { signaturesBuffer in
+          output.withUnsafeMutableBufferPointer { outputBuffer in
+            let hashesBase = hashesBuffer.baseAddress!
+            let signaturesBase = signaturesBuffer.baseAddress!
+            let outputBase = outputBuffer.baseAddress!
+            let recoverRange = { (range: Range<Int>) in
+              for i in range {
+                _ = self.recover(hash: hashesBase + i * 32, signature: signaturesBase + i * 64, recid: recids[i], compressed: compressed, output: outputBase + i * keyLength)
+              }
+            }
+
+            let chunks = concurrently ? min(count / Recoverer.minimumChunkSize, ProcessInfo.processInfo.activeProcessorCount) : 1
+            if chunks <= 1 {
+              recoverRange(0..<count)
+              return
+            }
+            let chunkSize = (count + chunks - 1) / chunks
+            DispatchQueue.concurrentPerform(iterations: chunks) { chunk in
+              recoverRange((chunk * chunkSize)..<min(count, (chunk + 1) * chunkSize))
+            }
+          }
+        }
+      }
+
+      return output
+    }
+
+    private func recover(hash: UnsafePointer<UInt8>, signature: UnsafePointer<UInt8>, recid: Int32, compressed: Bool, output: UnsafeMutablePointer<UInt8>) -> Bool {
+      // Out of range recid fails the argument check of secp256k1, which aborts
+      guard (0...3).contains(recid) else {
+        return false
+      }
+
+      var sig = secp256k1_ecdsa_recoverable_signature()
+      var publicKey = secp256k1_pubkey()
+      guard secp256k1_ecdsa_recoverable_signature_parse_compact(context, &sig, signature, recid) == 1,
+        secp256k1_ecdsa_recover(context, &publicKey, &sig, hash) == 1 else {
+        return false
+      }
+
+      var length = compressed ? 33 : 65
+      let flags = compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED
+      return secp256k1_ec_pubkey_serialize(context, output, &length, &publicKey, UInt32(flags)) == 1
+    }
+  }
+}
@@ -0,0 +1,398 @@
+//
+//  TKHash.c
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+// SHA-256 and RIPEMD-160 over 8 lanes, and Keccak-256, in portable C.
+// Every step runs the same operation on all lanes, innermost loops are over lanes so compilers vectorize them
+// (two NEON or one AVX2 register of 32-bit words). Lanes whose message has no block left run on zeros
+// and keep their state.
+
+#include "TKHash.h"
+
+#include <string.h>
+
+#define TK_LANES 8
+#define TK_BLOCK_SIZE 64
+#define TK_SHA256_DIGEST_SIZE 32
+#define TK_RIPEMD160_DIGEST_SIZE 20
+
+typedef uint32_t tk_lanes[TK_LANES];
+
+static inline uint32_t rotr(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t rotl(uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+/// Blocks of a message once padded with 0x80 and its 64-bit bit length.
+static inline size_t padded_blocks(size_t length) {
+  return (length + 8) / TK_BLOCK_SIZE + 1;
+}
+
+/// Words of one padded block, SHA-256 reads them big endian and RIPEMD-160 little endian.
+static void load_block(const uint8_t *message, size_t length, size_t block, int big_endian, uint32_t words[16]) {
+  uint8_t bytes[TK_BLOCK_SIZE];
+  size_t start = block * TK_BLOCK_SIZE;
+  if (start + TK_BLOCK_SIZE <= length) {
+    memcpy(bytes, message + start, TK_BLOCK_SIZE);
+  } else {
+    size_t tail = length > start ? length - start : 0;
+    if (tail > 0) {
+      memcpy(bytes, message + start, tail);
+    }
+    memset(bytes + tail, 0, TK_BLOCK_SIZE - tail);
+    if (length >= start) {
+      bytes[tail] = 0x80;
+    }
+    if (block + 1 == padded_blocks(length)) {
+      uint64_t bits = (uint64_t)length << 3;
+      for (int i = 0; i < 8; i++) {
+        bytes[big_endian ? TK_BLOCK_SIZE - 1 - i : TK_BLOCK_SIZE - 8 + i] = (uint8_t)(bits >> (8 * i));
+      }
+    }
+  }
+
+  for (int i = 0; i < 16; i++) {
+    const uint8_t *p = bytes + i * 4;
+    words[i] = big_endian
+      ? (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]
+      : (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0];
+  }
+}
+
+/// Transposes block b of each lane's message into block, and marks lanes which still have that block in mask.
+/// Returns whether any lane has it.
+static int gather_block(const uint8_t *const *messages, const size_t *lengths, size_t lanes, size_t b, int big_endian,
+                        tk_lanes block[16], tk_lanes mask) {
+  int any = 0;
+  for (size_t l = 0; l < TK_LANES; l++) {
+    uint32_t words[16] = {0};
+    mask[l] = 0;
+    if (l < lanes && b < padded_blocks(lengths[l])) {
+      load_block(messages[l], lengths[l], b, big_endian, words);
+      mask[l] = 0xffffffff;
+      any = 1;
+    }
+    for (int i = 0; i < 16; i++) {
+      block[i][l] = words[i];
+    }
+  }
+  return any;
+}
+
+// MARK: SHA-256
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t sha256_iv[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static void sha256_compress(tk_lanes state[8], const tk_lanes block[16], const tk_lanes mask) {
+  tk_lanes w[64];
+  memcpy(w, block, sizeof(tk_lanes) * 16);
+  for (int t = 16; t < 64; t++) {
+    for (int l = 0; l < TK_LANES; l++) {
+      uint32_t s0 = rotr(w[t - 15][l], 7) ^ rotr(w[t - 15][l], 18) ^ (w[t - 15][l] >> 3);
+      uint32_t s1 = rotr(w[t - 2][l], 17) ^ rotr(w[t - 2][l], 19) ^ (w[t - 2][l] >> 10);
+      w[t][l] = w[t - 16][l] + s0 + w[t - 7][l] + s1;
+    }
+  }
+
+  tk_lanes a, b, c, d, e, f, g, h;
+  for (int l = 0; l < TK_LANES; l++) {
+    a[l] = state[0][l]; b[l] = state[1][l]; c[l] = state[2][l]; d[l] = state[3][l];
+    e[l] = state[4][l]; f[l] = state[5][l]; g[l] = state[6][l]; h[l] = state[7][l];
+  }
+  for (int t = 0; t < 64; t++) {
+    for (int l = 0; l < TK_LANES; l++) {
+      uint32_t t1 = h[l] + (rotr(e[l], 6) ^ rotr(e[l], 11) ^ rotr(e[l], 25)) + ((e[l] & f[l]) ^ (~e[l] & g[l])) + sha256_k[t] + w[t][l];
+      uint32_t t2 = (rotr(a[l], 2) ^ rotr(a[l], 13) ^ rotr(a[l], 22)) + ((a[l] & b[l]) ^ (a[l] & c[l]) ^ (b[l] & c[l]));
+      h[l] = g[l]; g[l] = f[l]; f[l] = e[l]; e[l] = d[l] + t1;
+      d[l] = c[l]; c[l] = b[l]; b[l] = a[l]; a[l] = t1 + t2;
+    }
+  }
+  for (int l = 0; l < TK_LANES; l++) {
+    state[0][l] += a[l] & mask[l]; state[1][l] += b[l] & mask[l]; state[2][l] += c[l] & mask[l]; state[3][l] += d[l] & mask[l];
+    state[4][l] += e[l] & mask[l]; state[5][l] += f[l] & mask[l]; state[6][l] += g[l] & mask[l]; state[7][l] += h[l] & mask[l];
+  }
+}
+
+/// SHA-256 of up to TK_LANES messages, 32 bytes per message at output.
+static void sha256_lanes(const uint8_t *const *messages, const size_t *lengths, size_t lanes, uint8_t *output) {
+  tk_lanes state[8], block[16], mask;
+  for (int i = 0; i < 8; i++) {
+    for (int l = 0; l < TK_LANES; l++) {
+      state[i][l] = sha256_iv[i];
+    }
+  }
+  for (size_t b = 0; gather_block(messages, lengths, lanes, b, 1, block, mask); b++) {
+    sha256_compress(state, block, mask);
+  }
+
+  for (size_t l = 0; l < lanes; l++) {
+    uint8_t *digest = output + l * TK_SHA256_DIGEST_SIZE;
+    for (int i = 0; i < 8; i++) {
+      digest[i * 4] = (uint8_t)(state[i][l] >> 24);
+      digest[i * 4 + 1] = (uint8_t)(state[i][l] >> 16);
+      digest[i * 4 + 2] = (uint8_t)(state[i][l] >> 8);
+      digest[i * 4 + 3] = (uint8_t)state[i][l];
+    }
+  }
+}
+
+// MARK: RIPEMD-160
+
+// Message word and rotation of each step, left then right line
+static const uint8_t ripemd160_r[80] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+  3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+  1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+  4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+static const uint8_t ripemd160_r_prime[80] = {
+  5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+  6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+  15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+  8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+  12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+static const uint8_t ripemd160_s[80] = {
+  11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+  7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+  11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+  11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+  9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+static const uint8_t ripemd160_s_prime[80] = {
+  8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+  9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+  9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+  15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+  8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+static const uint32_t ripemd160_k[5] = {0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e};
+static const uint32_t ripemd160_k_prime[5] = {0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000};
+
+static const uint32_t ripemd160_iv[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+// Boolean functions of the five rounds of 16 steps, the right line runs them in reverse
+#define RIPEMD160_F0(x, y, z) ((x) ^ (y) ^ (z))
+#define RIPEMD160_F1(x, y, z) (((x) & (y)) | (~(x) & (z)))
+#define RIPEMD160_F2(x, y, z) (((x) | ~(y)) ^ (z))
+#define RIPEMD160_F3(x, y, z) (((x) & (z)) | ((y) & ~(z)))
+#define RIPEMD160_F4(x, y, z) ((x) ^ ((y) | ~(z)))
+
+// One round of both lines, spelled out per round so each step's boolean functions are fixed at compile time
+#define RIPEMD160_ROUND(round, f, f_prime) \
+  for (int j = (round) * 16; j < (round) * 16 + 16; j++) { \
+    const uint32_t *x = block[ripemd160_r[j]], *x_prime = block[ripemd160_r_prime[j]]; \
+    int s = ripemd160_s[j], s_prime = ripemd160_s_prime[j]; \
+    for (int l = 0; l < TK_LANES; l++) { \
+      uint32_t t = rotl(al[l] + f(bl[l], cl[l], dl[l]) + x[l] + ripemd160_k[round], s) + el[l]; \
+      al[l] = el[l]; el[l] = dl[l]; dl[l] = rotl(cl[l], 10); cl[l] = bl[l]; bl[l] = t; \
+      t = rotl(ar[l] + f_prime(br[l], cr[l], dr[l]) + x_prime[l] + ripemd160_k_prime[round], s_prime) + er[l]; \
+      ar[l] = er[l]; er[l] = dr[l]; dr[l] = rotl(cr[l], 10); cr[l] = br[l]; br[l] = t; \
+    } \
+  }
+
+static void ripemd160_compress(tk_lanes state[5], const tk_lanes block[16], const tk_lanes mask) {
+  tk_lanes al, bl, cl, dl, el, ar, br, cr, dr, er;
+  for (int l = 0; l < TK_LANES; l++) {
+    al[l] = ar[l] = state[0][l];
+    bl[l] = br[l] = state[1][l];
+    cl[l] = cr[l] = state[2][l];
+    dl[l] = dr[l] = state[3][l];
+    el[l] = er[l] = state[4][l];
+  }
+
+  RIPEMD160_ROUND(0, RIPEMD160_F0, RIPEMD160_F4)
+  RIPEMD160_ROUND(1, RIPEMD160_F1, RIPEMD160_F3)
+  RIPEMD160_ROUND(2, RIPEMD160_F2, RIPEMD160_F2)
+  RIPEMD160_ROUND(3, RIPEMD160_F3, RIPEMD160_F1)
+  RIPEMD160_ROUND(4, RIPEMD160_F4, RIPEMD160_F0)
+
+  for (int l = 0; l < TK_LANES; l++) {
+    uint32_t t = state[1][l] + cl[l] + dr[l];
+    uint32_t m = mask[l], n = ~mask[l];
+    state[1][l] = ((state[2][l] + dl[l] + er[l]) & m) | (state[1][l] & n);
+    state[2][l] = ((state[3][l] + el[l] + ar[l]) & m) | (state[2][l] & n);
+    state[3][l] = ((state[4][l] + al[l] + br[l]) & m) | (state[3][l] & n);
+    state[4][l] = ((state[0][l] + bl[l] + cr[l]) & m) | (state[4][l] & n);
+    state[0][l] = (t & m) | (state[0][l] & n);
+  }
+}
+
+/// RIPEMD-160 of up to TK_LANES messages, 20 bytes per message at output.
+static void ripemd160_lanes(const uint8_t *const *messages, const size_t *lengths, size_t lanes, uint8_t *output) {
+  tk_lanes state[5], block[16], mask;
+  for (int i = 0; i < 5; i++) {
+    for (int l = 0; l < TK_LANES; l++) {
+      state[i][l] = ripemd160_iv[i];
+    }
+  }
+  for (size_t b = 0; gather_block(messages, lengths, lanes, b, 0, block, mask); b++) {
+    ripemd160_compress(state, block, mask);
+  }
+
+  for (size_t l = 0; l < lanes; l++) {
+    uint8_t *digest = output + l * TK_RIPEMD160_DIGEST_SIZE;
+    for (int i = 0; i < 5; i++) {
+      digest[i * 4] = (uint8_t)state[i][l];
+      digest[i * 4 + 1] = (uint8_t)(state[i][l] >> 8);
+      digest[i * 4 + 2] = (uint8_t)(state[i][l] >> 16);
+      digest[i * 4 + 3] = (uint8_t)(state[i][l] >> 24);
+    }
+  }
+}
+
+// MARK: Batches
+
+typedef void (*tk_lanes_hash)(const uint8_t *const *messages, const size_t *lengths, size_t lanes, uint8_t *output);
+
+/// Runs first over each group of TK_LANES messages, then second, if any, over the digests of first.
+static void hash_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output,
+                      tk_lanes_hash first, size_t first_digest_size, tk_lanes_hash second, size_t digest_size) {
+  const uint8_t *messages[TK_LANES];
+  size_t lengths[TK_LANES];
+  uint8_t intermediate[TK_LANES * TK_SHA256_DIGEST_SIZE];
+
+  for (size_t i = 0; i < count; i += TK_LANES) {
+    size_t lanes = count - i < TK_LANES ? count - i : TK_LANES;
+    for (size_t l = 0; l < lanes; l++) {
+      messages[l] = data + offsets[i + l];
+      lengths[l] = offsets[i + l + 1] - offsets[i + l];
+    }
+    if (second == NULL) {
+      first(messages, lengths, lanes, output + i * digest_size);
+      continue;
+    }
+
+    first(messages, lengths, lanes, intermediate);
+    for (size_t l = 0; l < lanes; l++) {
+      messages[l] = intermediate + l * first_digest_size;
+      lengths[l] = first_digest_size;
+    }
+    second(messages, lengths, lanes, output + i * digest_size);
+  }
+}
+
+void tk_ripemd160_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output) {
+  hash_many(data, offsets, count, output, ripemd160_lanes, TK_RIPEMD160_DIGEST_SIZE, NULL, TK_RIPEMD160_DIGEST_SIZE);
+}
+
+void tk_hash160_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output) {
+  hash_many(data, offsets, count, output, sha256_lanes, TK_SHA256_DIGEST_SIZE, ripemd160_lanes, TK_RIPEMD160_DIGEST_SIZE);
+}
+
+void tk_sha256d_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output) {
+  hash_many(data, offsets, count, output, sha256_lanes, TK_SHA256_DIGEST_SIZE, sha256_lanes, TK_SHA256_DIGEST_SIZE);
+}
+
+// MARK: Keccak-256
+
+static const uint64_t keccak_round_constants[24] = {
+  0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+  0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+  0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+  0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+  0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+  0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+};
+
+static inline uint64_t rotl64(uint64_t x, int n) {
+  return (x << n) | (x >> (64 - n));
+}
+
+// Theta column parity and chi row, unrolled so every lane index is a constant
+#define KECCAK_THETA(x) \
+  t = c[(x + 4) % 5] ^ rotl64(c[(x + 1) % 5], 1); \
+  state[x] ^= t; state[x + 5] ^= t; state[x + 10] ^= t; state[x + 15] ^= t; state[x + 20] ^= t;
+
+// Moves the carried lane t into lane with its rotation, picking up the lane's old value
+#define KECCAK_RHO_PI(lane, rotation) \
+  c[0] = state[lane]; state[lane] = rotl64(t, rotation); t = c[0];
+
+#define KECCAK_CHI(y) \
+  c[0] = state[y]; c[1] = state[y + 1]; c[2] = state[y + 2]; c[3] = state[y + 3]; c[4] = state[y + 4]; \
+  state[y] = c[0] ^ (~c[1] & c[2]); \
+  state[y + 1] = c[1] ^ (~c[2] & c[3]); \
+  state[y + 2] = c[2] ^ (~c[3] & c[4]); \
+  state[y + 3] = c[3] ^ (~c[4] & c[0]); \
+  state[y + 4] = c[4] ^ (~c[0] & c[1]);
+
+/// Keccak-f[1600] on 25 lanes, lane x + 5y at state[x + 5 * y].
+static void keccak_f1600(uint64_t state[25]) {
+  uint64_t c[5], t;
+  for (int round = 0; round < 24; round++) {
+    for (int x = 0; x < 5; x++) {
+      c[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+    }
+    KECCAK_THETA(0) KECCAK_THETA(1) KECCAK_THETA(2) KECCAK_THETA(3) KECCAK_THETA(4)
+
+    // Rho and pi, walking lanes from (1, 0)
+    t = state[1];
+    KECCAK_RHO_PI(10, 1) KECCAK_RHO_PI(7, 3) KECCAK_RHO_PI(11, 6) KECCAK_RHO_PI(17, 10)
+    KECCAK_RHO_PI(18, 15) KECCAK_RHO_PI(3, 21) KECCAK_RHO_PI(5, 28) KECCAK_RHO_PI(16, 36)
+    KECCAK_RHO_PI(8, 45) KECCAK_RHO_PI(21, 55) KECCAK_RHO_PI(24, 2) KECCAK_RHO_PI(4, 14)
+    KECCAK_RHO_PI(15, 27) KECCAK_RHO_PI(23, 41) KECCAK_RHO_PI(19, 56) KECCAK_RHO_PI(13, 8)
+    KECCAK_RHO_PI(12, 25) KECCAK_RHO_PI(2, 43) KECCAK_RHO_PI(20, 62) KECCAK_RHO_PI(14, 18)
+    KECCAK_RHO_PI(22, 39) KECCAK_RHO_PI(9, 61) KECCAK_RHO_PI(6, 20) KECCAK_RHO_PI(1, 44)
+
+    KECCAK_CHI(0) KECCAK_CHI(5) KECCAK_CHI(10) KECCAK_CHI(15) KECCAK_CHI(20)
+
+    state[0] ^= keccak_round_constants[round];
+  }
+}
+
+static inline uint64_t load64_le(const uint8_t *p) {
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; i--) {
+    v = v << 8 | p[i];
+  }
+  return v;
+}
+
+void tk_keccak256(const uint8_t *data, size_t length, uint8_t *output) {
+  enum { rate = 136 };
+  uint64_t state[25] = {0};
+  while (length >= rate) {
+    for (int i = 0; i < rate / 8; i++) {
+      state[i] ^= load64_le(data + i * 8);
+    }
+    keccak_f1600(state);
+    data += rate;
+    length -= rate;
+  }
+
+  uint8_t last[rate] = {0};
+  if (length > 0) {
+    memcpy(last, data, length);
+  }
+  last[length] = 0x01;
+  last[rate - 1] |= 0x80;
+  for (int i = 0; i < rate / 8; i++) {
+    state[i] ^= load64_le(last + i * 8);
+  }
+  keccak_f1600(state);
+
+  for (int i = 0; i < 32; i++) {
+    output[i] = (uint8_t)(state[i / 8] >> (8 * (i % 8)));
+  }
+}
@@ -0,0 +1,31 @@
+//
+//  TKHash.h
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+#ifndef TKHash_h
+#define TKHash_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Hashes in portable C. The _many functions are multi-buffer, several messages side by side in one pass over their blocks.
+// Message i of a batch is data[offsets[i] ..< offsets[i + 1]], so offsets holds count + 1 entries.
+// Digests are written to output in message order.
+
+/// RIPEMD-160 of each message, 20 bytes per message.
+void tk_ripemd160_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output);
+
+/// RIPEMD160(SHA256(message)), Bitcoin's Hash160, 20 bytes per message.
+void tk_hash160_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output);
+
+/// SHA256(SHA256(message)), 32 bytes per message.
+void tk_sha256d_many(const uint8_t *data, const size_t *offsets, size_t count, uint8_t *output);
+
+/// Keccak-256 as Ethereum uses it, original 0x01 padding rather than SHA3's, 32 bytes at output.
+void tk_keccak256(const uint8_t *data, size_t length, uint8_t *output);
+
+#endif /* TKHash_h */
@@ -67,6 +67,7 @@ public enum GenericError: String, AppError {
   case wifWrongNetwork = "wif_wrong_network"
   case insufficientFunds = "insufficient_funds"
   case amountLessThanMinimum = "amount_less_than_minimum"
+  case operationCancelled = "operation_cancelled"
 }
 
 public enum EOSError: String, AppError {
@@ -83,6 +84,10 @@ public enum IdentityError: String, AppError {
   case invalidEncryptionDataSignature = "invalid_encryption_data_signature"
 }
 
+public enum RLPError: String, AppError {
+  case invalid = "rlp_invalid"
+}
+
 extension String : AppError {
   public var message: String {
     return self
@@ -53,6 +53,9 @@ extension BTCTransaction {
 }
 
 class SegWitInput: BTCTransactionInput {
+  /// scriptSig length and push length of the 22 bytes P2WPKH redeem script that follows.
+  static let scriptPrefix: [UInt8] = [23, 22]
+
   override var data: Data! {
     let payload = NSMutableData()
 
@@ -63,8 +66,7 @@ class SegWitInput: BTCTransactionInput {
       payload.append(BTCProtocolSerialization.data(forVarInt: UInt64(coinbaseData.count)))
       payload.append(coinbaseData)
     } else {
-      payload.append(BTCProtocolSerialization.data(forVarInt: 23))
-      payload.append(BTCProtocolSerialization.data(forVarInt: 22))
+      payload.append(SegWitInput.scriptPrefix, length: SegWitInput.scriptPrefix.count)
       payload.append(signatureScript.data)
     }
 
@@ -0,0 +1,233 @@
+//
+//  BTCTransactionSerializer.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+import CommonCrypto
+import CoreBitcoin
+
+/// Serializes a BTCTransaction into one buffer sized up front, witness encoding if any input has witness data.
+/// The legacy encoding is a subsequence of the witness one (no marker, flag and witnesses),
+/// so txid hashes those ranges of the same buffer instead of serializing again.
+struct BTCTransactionSerializer {
+  let bytes: [UInt8]
+  /// Offset and length of the inputs and outputs, shared by both encodings.
+  private let body: (offset: Int, count: Int)
+
+  init(transaction: BTCTransaction) {
+    let txInputs = transaction.inputs.map { $0 as! BTCTransactionInput }
+    let inputs = txInputs.map(InputScript.init(input:))
+    let outputs = transaction.outputs.map { $0 as! BTCTransactionOutput }
+    let outputScripts = outputs.map { ($0.script?.data ?? Data()) as Data }
+    let hasWitness = inputs.contains { $0.witness != nil }
+
+    var bodySize = BTCTransactionSerializer.varIntSize(inputs.count) + BTCTransactionSerializer.varIntSize(outputs.count)
+    bodySize += inputs.reduce(0) { $0 + 32 + 4 + $1.size + 4 }
+    bodySize += outputScripts.reduce(0) { $0 + 8 + BTCTransactionSerializer.varIntSize($1.count) + $1.count }
+    let witnessSize = hasWitness ? inputs.reduce(0) { $0 + $1.witnessSize } : 0
+    let headerSize = 4 + (hasWitness ? 2 : 0)
+
+    var bytes = [UInt8](repeating: 0, count: headerSize + bodySize + witnessSize + 4)
+    bytes.withUnsafeMutableBufferPointer { buffer in
+      var writer = Writer(base: buffer.baseAddress!)
+      writer.write(littleEndian: transaction.version)
+      if hasWitness {
+        writer.write(UInt8(truncatingIfNeeded: transaction.marker))
+        writer.write(UInt8(truncatingIfNeeded: transaction.flag))
+      }
+
+      writer.write(varInt: inputs.count)
+      for (script, input) in zip(inputs, txInputs) {
+        writer.write(input.previousHash)
+        writer.write(littleEndian: input.previousIndex)
+        script.write(to: &writer)
+        writer.write(littleEndian: input.sequence)
+      }
+
+      writer.write(varInt: outputs.count)
+      for (script, output) in zip(outputScripts, outputs) {
+        writer.write(littleEndian: UInt64(bitPattern: output.value))
+        writer.write(varInt: script.count)
+        writer.write(script)
+      }
+
+      if hasWitness {
+        inputs.forEach { $0.writeWitness(to: &writer) }
+      }
+      writer.write(littleEndian: transaction.lockTime)
+    }
+
+    self.bytes = bytes
+    body = (headerSize, bodySize)
+  }
+
+  var hex: String {
+    return Hex.hex(from: bytes)
+  }
+
+  /// Hash of the legacy encoding: version, inputs and outputs, lock time.
+  var txID: String {
+    return bytes.withUnsafeBufferPointer { buffer -> String in
+      let base = buffer.baseAddress!
+      let hash = BTCTransactionSerializer.sha256d([
+        (base, 4),
+        (base + body.offset, body.count),
+        (base + buffer.count - 4, 4)
+      ])
+      return Hex.hex(from: hash.reversed())
+    }
+  }
+
+  /// Hash of the whole buffer, equal to txID when no input has witness data.
+  var witnessTxID: String {
+    return bytes.withUnsafeBufferPointer { buffer in
+      Hex.hex(from: BTCTransactionSerializer.sha256d([(buffer.baseAddress!, buffer.count)]).reversed())
+    }
+  }
+
+  private static func sha256d(_ parts: [(UnsafePointer<UInt8>, Int)]) -> [UInt8] {
+    var context = CC_SHA256_CTX()
+    CC_SHA256_Init(&context)
+    for (pointer, count) in parts {
+      CC_SHA256_Update(&context, pointer, CC_LONG(count))
+    }
+    var first = [UInt8](repeating: 0, count: Int(CC_SHA256_DIGEST_LENGTH))
+    CC_SHA256_Final(&first, &context)
+
+    var second = [UInt8](repeating: 0, count: Int(CC_SHA256_DIGEST_LENGTH))
+    CC_SHA256(first, CC_LONG(first.count), &second)
+    return second
+  }
+
+  static func varIntSize(_ value: Int) -> Int {
+    switch UInt64(value) {
+    case 0..<0xfd:
+      return 1
+    case 0xfd...0xffff:
+      return 3
+    case 0x10000...0xffffffff:
+      return 5
+    default:
+      return 9
+    }
+  }
+}
+
+/// Script and witness of an input, read from CoreBitcoin once to both measure and write them.
+private struct InputScript {
+  enum Kind {
+    case script
+    // SegWitInput writes the P2SH-P2WPKH scriptSig length and push prefix verbatim
+    case nestedWitness
+  }
+
+  let kind: Kind
+  let data: Data
+  let witness: [BTCScriptChunk]?
+
+  init(input: BTCTransactionInput) {
+    if input.isCoinbase {
+      kind = .script
+      data = input.coinbaseData
+    } else {
+      kind = input is SegWitInput ? .nestedWitness : .script
+      data = (input.signatureScript?.data ?? Data()) as Data
+    }
+    witness = input.witnessData.map { $0.scriptChunks.map { $0 as! BTCScriptChunk } }
+  }
+
+  var size: Int {
+    switch kind {
+    case .script:
+      return BTCTransactionSerializer.varIntSize(data.count) + data.count
+    case .nestedWitness:
+      return SegWitInput.scriptPrefix.count + data.count
+    }
+  }
+
+  var witnessSize: Int {
+    guard let chunks = witness else {
+      return 1
+    }
+    return chunks.reduce(BTCTransactionSerializer.varIntSize(chunks.count)) { size, chunk in
+      if chunk.isOpcode {
+        return size + 1
+      }
+      let count = chunk.pushdata?.count ?? 0
+      return size + BTCTransactionSerializer.varIntSize(count) + count
+    }
+  }
+
+  func write(to writer: inout Writer) {
+    switch kind {
+    case .script:
+      writer.write(varInt: data.count)
+    case .nestedWitness:
+      SegWitInput.scriptPrefix.forEach { writer.write($0) }
+    }
+    writer.write(data)
+  }
+
+  func writeWitness(to writer: inout Writer) {
+    guard let chunks = witness else {
+      writer.write(UInt8(0))
+      return
+    }
+    writer.write(varInt: chunks.count)
+    for chunk in chunks {
+      if chunk.isOpcode {
+        writer.write(chunk.opcode.rawValue)
+      } else if let pushdata = chunk.pushdata {
+        writer.write(varInt: pushdata.count)
+        writer.write(pushdata)
+      }
+    }
+  }
+}
+
+/// Appends to memory already sized for everything written, no bounds checks.
+private struct Writer {
+  private let base: UnsafeMutablePointer<UInt8>
+  private var offset = 0
+
+  init(base: UnsafeMutablePointer<UInt8>) {
+    self.base = base
+  }
+
+  mutating func write(_ byte: UInt8) {
+    base[offset] = byte
+    offset += 1
+  }
+
+  mutating func write<T: FixedWidthInteger>(littleEndian value: T) {
+    for i in 0..<MemoryLayout<T>.size {
+      base[offset + i] = UInt8(truncatingIfNeeded: value >> (i * 8))
+    }
+    offset += MemoryLayout<T>.size
+  }
+
+  mutating func write(_ data: Data) {
+    data.copyBytes(to: base + offset, count: data.count)
+    offset += data.count
+  }
+
+  mutating func write(varInt value: Int) {
+    switch BTCTransactionSerializer.varIntSize(value) {
+    case 1:
+      write(UInt8(value))
+    case 3:
+      write(UInt8(0xfd))
+      write(littleEndian: UInt16(value))
+    case 5:
+      write(UInt8(0xfe))
+      write(littleEndian: UInt32(value))
+    default:
+      write(UInt8(0xff))
+      write(littleEndian: UInt64(value))
+    }
+  }
+}
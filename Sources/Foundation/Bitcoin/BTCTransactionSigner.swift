@@ -77,10 +77,11 @@ class BTCTransactionSigner {
   let fee: Int64
   let toAddress: BTCAddress
   let changeAddress: BTCAddress
-  let dustThreshold: Int64 = 2730
+  /// Smallest output amount, the payment is rejected and change goes to fee below it.
+  static let dustThreshold: Int64 = 2730
 
   init(utxos: [UTXO], keys: [BTCKey], amount: Int64, fee: Int64, toAddress: BTCAddress, changeAddress: BTCAddress) throws {
-    guard amount >= dustThreshold else {
+    guard amount >= BTCTransactionSigner.dustThreshold else {
       throw GenericError.amountLessThanMinimum
     }
 
@@ -105,15 +106,14 @@ class BTCTransactionSigner {
     rawTx.addOutput(BTCTransactionOutput(value: amount, address: toAddress))
 
     let changeAmount = totalAmount - amount - fee
-    if changeAmount >= dustThreshold {
+    if changeAmount >= BTCTransactionSigner.dustThreshold {
         rawTx.addOutput(BTCTransactionOutput(value: changeAmount, address: changeAddress))
     }
 
     try rawTx.sign(with: keys, isSegWit: false)
 
-    let signedTx = rawTx.hex!
-    let txHash = rawTx.transactionID!
-    return TransactionSignedResult(signedTx: signedTx, txHash: txHash)
+    let serializer = BTCTransactionSerializer(transaction: rawTx)
+    return TransactionSignedResult(signedTx: serializer.hex, txHash: serializer.txID)
   }
 
   func signSegWit() throws -> TransactionSignedResult {
@@ -130,16 +130,14 @@ class BTCTransactionSigner {
     rawTx.addOutput(BTCTransactionOutput(value: amount, address: toAddress))
 
     let changeAmount = rawTx.calculateTotalSpend(utxos: utxos) - amount - fee
-    if changeAmount >= dustThreshold {
+    if changeAmount >= BTCTransactionSigner.dustThreshold {
       rawTx.addOutput(BTCTransactionOutput(value: changeAmount, address: changeAddress))
     }
 
     try rawTx.sign(with: keys, isSegWit: true)
 
-    let signedTx = rawTx.hexWithWitness!
-    let txHash = rawTx.transactionID!
-    let wtxID = rawTx.witnessTransactionID!
-    return TransactionSignedResult(signedTx: signedTx, txHash: txHash, wtxID: wtxID)
+    let serializer = BTCTransactionSerializer(transaction: rawTx)
+    return TransactionSignedResult(signedTx: serializer.hex, txHash: serializer.txID, wtxID: serializer.witnessTxID)
   }
 
 }
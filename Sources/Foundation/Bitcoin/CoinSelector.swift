@@ -0,0 +1,300 @@
+//
+//  CoinSelector.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+public enum CoinSelectionStrategy {
+  /// Search for inputs that need no change output, knapsack if there's none.
+  case branchAndBound
+  /// Randomized subset of the smaller UTXOs closest above the target.
+  case knapsack
+  /// Biggest UTXOs first, fewest inputs.
+  case largestFirst
+}
+
+/// Picks the UTXOs funding a payment and sizes the fee from a fee rate and the virtual size of the transaction.
+/// Every UTXO counts at its effective value, its amount minus the fee of spending it,
+/// so inputs costing more than they bring are never picked.
+struct CoinSelector {
+  struct Selection {
+    let utxos: [UTXO]
+    let fee: Int64
+    /// 0 if what's left is too little for a change output and goes to fee.
+    let change: Int64
+  }
+
+  /// Sizes in weight units, 4 for a non witness byte and 1 for a witness byte.
+  /// Signatures are counted at their 72 bytes maximum.
+  enum Weight {
+    /// Version, one byte input and output counts, lock time.
+    static let overhead = (4 + 1 + 1 + 4) * 4
+    /// SegWit marker and flag.
+    static let witnessOverhead = 2
+    /// Outpoint, scriptSig with signature and compressed public key, sequence.
+    static let p2pkhInput = (32 + 4 + 1 + 107 + 4) * 4
+    /// Outpoint, scriptSig with the P2WPKH redeem script, sequence; then witness with signature and compressed public key.
+    static let p2shP2wpkhInput = (32 + 4 + 1 + 23 + 4) * 4 + (1 + 1 + 72 + 1 + 33)
+
+    static func output(scriptLength: Int) -> Int {
+      return (8 + 1 + scriptLength) * 4
+    }
+  }
+
+  static var maxBranchAndBoundTries = 100_000
+  /// Upper bound of knapsack iterations times candidates, iterations stay within 16...1000.
+  static var maxKnapsackWork = 1_000_000
+
+  /// Satoshis per virtual byte.
+  let feeRate: Int64
+  let isSegWit: Bool
+  let paymentScriptLength: Int
+  let changeScriptLength: Int
+  /// Seed of the knapsack's random inclusion.
+  var seed: UInt64 = UInt64(arc4random()) << 32 | UInt64(arc4random())
+
+  init(feeRate: Int64, isSegWit: Bool, paymentScriptLength: Int = 25, changeScriptLength: Int? = nil) {
+    self.feeRate = feeRate
+    self.isSegWit = isSegWit
+    self.paymentScriptLength = paymentScriptLength
+    // Change goes to a P2SH-P2WPKH or a P2PKH address
+    self.changeScriptLength = changeScriptLength ?? (isSegWit ? 23 : 25)
+  }
+
+  var inputWeight: Int {
+    return isSegWit ? Weight.p2shP2wpkhInput : Weight.p2pkhInput
+  }
+
+  /// Fee of a transaction, vsize is weight / 4 rounded up.
+  func fee(weight: Int) -> Int64 {
+    return Int64((weight + 3) / 4) * feeRate
+  }
+
+  func select(from utxos: [UTXO], amount: Int64, strategy: CoinSelectionStrategy = .branchAndBound) throws -> Selection {
+    let inputFee = fee(weight: inputWeight)
+    let candidates = utxos.enumerated().compactMap { index, utxo -> Candidate? in
+      let value = utxo.amount - inputFee
+      return value > 0 ? Candidate(index: index, value: value) : nil
+    }
+    let target = amount + fee(weight: baseWeight(inputCount: 1))
+    let costOfChange = fee(weight: Weight.output(scriptLength: changeScriptLength))
+    guard candidates.reduce(0, { $0 + $1.value }) >= target else {
+      throw GenericError.insufficientFunds
+    }
+
+    let picked: [Candidate]?
+    switch strategy {
+    case .branchAndBound:
+      picked = branchAndBound(candidates, target: target, costOfChange: costOfChange)
+        ?? knapsack(candidates, target: target, minimumChange: costOfChange + BTCTransactionSigner.dustThreshold)
+    case .knapsack:
+      picked = knapsack(candidates, target: target, minimumChange: costOfChange + BTCTransactionSigner.dustThreshold)
+    case .largestFirst:
+      picked = largestFirst(candidates, target: target)
+    }
+
+    guard let chosen = picked, let selection = settle(chosen.map { utxos[$0.index] }, amount: amount) else {
+      throw GenericError.insufficientFunds
+    }
+    return selection
+  }
+
+  /// Weight without inputs, for one payment output and no change.
+  private func baseWeight(inputCount: Int) -> Int {
+    let countsWeight = (BTCTransactionSerializer.varIntSize(inputCount) - 1) * 4
+    return Weight.overhead + (isSegWit ? Weight.witnessOverhead : 0) + countsWeight + Weight.output(scriptLength: paymentScriptLength)
+  }
+
+  /// Fee and change of spending utxos on the exact weight, adding a change output only if it's above dust.
+  private func settle(_ utxos: [UTXO], amount: Int64) -> Selection? {
+    let total = utxos.reduce(0) { $0 + $1.amount }
+    let weight = baseWeight(inputCount: utxos.count) + utxos.count * inputWeight
+    let feeWithChange = fee(weight: weight + Weight.output(scriptLength: changeScriptLength))
+    let change = total - amount - feeWithChange
+    if change >= BTCTransactionSigner.dustThreshold {
+      return Selection(utxos: utxos, fee: feeWithChange, change: change)
+    }
+    guard total - amount >= fee(weight: weight) else {
+      return nil
+    }
+    return Selection(utxos: utxos, fee: total - amount, change: 0)
+  }
+
+  /// Depth first search over including or omitting each candidate, biggest first,
+  /// for the set landing in [target, target + costOfChange] with the least excess.
+  private func branchAndBound(_ candidates: [Candidate], target: Int64, costOfChange: Int64) -> [Candidate]? {
+    let pool = candidates.sorted { $0.value > $1.value }
+    var available = pool.reduce(0) { $0 + $1.value }
+    var value: Int64 = 0
+    var included = [Bool]()
+    included.reserveCapacity(pool.count)
+    var best: [Bool]?
+    var bestExcess = Int64.max
+
+    for _ in 0..<CoinSelector.maxBranchAndBoundTries {
+      var backtrack = false
+      if value + available < target || value > target + costOfChange {
+        backtrack = true
+      } else if value >= target {
+        if value - target < bestExcess {
+          best = included
+          bestExcess = value - target
+          if bestExcess == 0 {
+            break
+          }
+        }
+        backtrack = true
+      }
+
+      if backtrack {
+        // Back to the last included candidate whose omission branch is left
+        while let last = included.last, !last {
+          included.removeLast()
+          available += pool[included.count].value
+        }
+        guard !included.isEmpty else {
+          break
+        }
+        included[included.count - 1] = false
+        value -= pool[included.count - 1].value
+      } else {
+        let candidate = pool[included.count]
+        available -= candidate.value
+        // Including it after omitting an equal one only repeats the branch just searched
+        if let last = included.last, !last, candidate.value == pool[included.count - 1].value {
+          included.append(false)
+        } else {
+          included.append(true)
+          value += candidate.value
+        }
+      }
+    }
+
+    return best.map { selected in zip(pool, selected).filter { $0.1 }.map { $0.0 } }
+  }
+
+  /// An exact match if there's one, otherwise the closer of the smallest single candidate above target + minimumChange
+  /// and a random subset of the smaller ones.
+  private func knapsack(_ candidates: [Candidate], target: Int64, minimumChange: Int64) -> [Candidate]? {
+    var smaller = [Candidate]()
+    var smallerTotal: Int64 = 0
+    var lowestLarger: Candidate?
+    for candidate in candidates {
+      if candidate.value == target {
+        return [candidate]
+      }
+      if candidate.value < target + minimumChange {
+        smaller.append(candidate)
+        smallerTotal += candidate.value
+      } else if candidate.value < lowestLarger?.value ?? Int64.max {
+        lowestLarger = candidate
+      }
+    }
+
+    if smallerTotal == target {
+      return smaller
+    }
+    if smallerTotal < target {
+      return lowestLarger.map { [$0] }
+    }
+
+    smaller.sort { $0.value > $1.value }
+    let values = smaller.map { $0.value }
+    var generator = SplitMix64(seed: seed)
+    var (best, bestTotal) = approximateBestSubset(values, total: smallerTotal, target: target, generator: &generator)
+    if bestTotal != target && smallerTotal >= target + minimumChange {
+      (best, bestTotal) = approximateBestSubset(values, total: smallerTotal, target: target + minimumChange, generator: &generator)
+    }
+
+    if let larger = lowestLarger, (bestTotal != target && bestTotal < target + minimumChange) || larger.value <= bestTotal {
+      return [larger]
+    }
+    return zip(smaller, best).filter { $0.1 }.map { $0.0 }
+  }
+
+  /// Randomly include values until target is reached, keeping the smallest total above it.
+  private func approximateBestSubset(_ values: [Int64], total: Int64, target: Int64, generator: inout SplitMix64) -> ([Bool], Int64) {
+    var best = [Bool](repeating: true, count: values.count)
+    var bestTotal = total
+    var included = [Bool](repeating: false, count: values.count)
+    let iterations = max(16, min(1000, CoinSelector.maxKnapsackWork / max(1, values.count)))
+
+    for _ in 0..<iterations where bestTotal != target {
+      for i in included.indices {
+        included[i] = false
+      }
+      var sum: Int64 = 0
+      var reachedTarget = false
+      for pass in 0..<2 where !reachedTarget {
+        for i in values.indices where pass == 0 ? generator.nextBool() : !included[i] {
+          sum += values[i]
+          included[i] = true
+          if sum >= target {
+            reachedTarget = true
+            if sum < bestTotal {
+              bestTotal = sum
+              best = included
+            }
+            sum -= values[i]
+            included[i] = false
+          }
+        }
+      }
+    }
+    return (best, bestTotal)
+  }
+
+  private func largestFirst(_ candidates: [Candidate], target: Int64) -> [Candidate]? {
+    var picked = [Candidate]()
+    var value: Int64 = 0
+    for candidate in candidates.sorted(by: { $0.value > $1.value }) {
+      picked.append(candidate)
+      value += candidate.value
+      if value >= target {
+        return picked
+      }
+    }
+    return nil
+  }
+}
+
+private struct Candidate {
+  /// Position in the UTXOs passed in.
+  let index: Int
+  /// Amount minus the fee of spending it.
+  let value: Int64
+}
+
+/// Small fast generator for the knapsack, handing out random bits one at a time.
+private struct SplitMix64 {
+  private var state: UInt64
+  private var bits: UInt64 = 0
+  private var bitsLeft = 0
+
+  init(seed: UInt64) {
+    state = seed
+  }
+
+  mutating func next() -> UInt64 {
+    state = state &+ 0x9e3779b97f4a7c15
+    var z = state
+    z = (z ^ (z >> 30)) &* 0xbf58476d1ce4e5b9
+    z = (z ^ (z >> 27)) &* 0x94d049bb133111eb
+    return z ^ (z >> 31)
+  }
+
+  mutating func nextBool() -> Bool {
+    if bitsLeft == 0 {
+      bits = next()
+      bitsLeft = 64
+    }
+    bitsLeft -= 1
+    let bit = bits & 1 == 1
+    bits >>= 1
+    return bit
+  }
+}
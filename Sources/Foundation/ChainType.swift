@@ -19,4 +19,11 @@ public enum ChainType: String {
     }
     return .wif
   }
+
+  /// Address without 0x prefix, for comparing addresses of this chain.
+  /// ETH addresses are case insensitive, checksummed and lowercase forms normalize to the same one.
+  func normalizedAddress(_ address: String) -> String {
+    let address = address.removePrefix0xIfNeeded()
+    return self == .eth ? address.lowercased() : address
+  }
 }
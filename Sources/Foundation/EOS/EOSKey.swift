@@ -13,10 +13,7 @@ class EOSKey {
   private let btcKey: BTCKey
 
   var publicKey: String {
-    let publicKey = btcKey.compressedPublicKey as Data
-    let checksum = (BTCRIPEMD160(publicKey) as Data).bytes[0..<4]
-    let base58 = BTCBase58StringWithData(publicKey + checksum)!
-    return "EOS" + base58
+    return EOSKey.publicKey(fromCompressed: btcKey.compressedPublicKey as Data)
   }
 
   var wif: String {
@@ -47,6 +44,40 @@ class EOSKey {
     return EOSKey(key: key).publicKey
   }
 
+  /// Recover public keys of many signatures with one secp256k1 context, nil for each signature that fails.
+  /// - Parameter hashes: 32 bytes hashes.
+  /// - Parameter signatures: 65 bytes signatures, header byte followed by r and s.
+  public static func batchEcRecover(hashes: [Data], signatures: [Data]) throws -> [String?] {
+    guard hashes.count == signatures.count else {
+      throw GenericError.paramError
+    }
+
+    var packedHashes = [UInt8]()
+    var compactSignatures = [UInt8]()
+    var recids = [Int32]()
+    for (hash, signature) in zip(hashes, signatures) {
+      guard hash.count == 32 && signature.count == 65 else {
+        throw GenericError.paramError
+      }
+      let signatureBytes = signature.bytes
+      packedHashes.append(contentsOf: hash.bytes)
+      compactSignatures.append(contentsOf: signatureBytes[1..<65])
+      recids.append((Int32(signatureBytes[0]) - 27) & 3)
+    }
+
+    let publicKeys = Encryptor.Secp256k1.Recoverer.shared.recoverPacked(hashes: packedHashes, signatures: compactSignatures, recids: recids, compressed: true, concurrently: true)!
+    return (0..<recids.count).map { i -> String? in
+      let publicKey = Data(bytes: publicKeys[(i * 33)..<(i * 33 + 33)])
+      return publicKey[0] == 0 ? nil : EOSKey.publicKey(fromCompressed: publicKey)
+    }
+  }
+
+  static func publicKey(fromCompressed publicKey: Data) -> String {
+    let checksum = (BTCRIPEMD160(publicKey) as Data).bytes[0..<4]
+    let base58 = BTCBase58StringWithData(publicKey + checksum)!
+    return "EOS" + base58
+  }
+
   static func privateKey(from wif: String) -> [UInt8] {
     let wifBytes = (BTCDataFromBase58(wif) as Data).bytes
     return [UInt8].init(wifBytes[1..<wifBytes.count - 4])
@@ -11,7 +11,7 @@ import CoreBitcoin
 
 public final class EOSTransaction {
   private let data: String // Hex tx data
-  private let publicKeys: [String]
+  let publicKeys: [String]
   private let chainID: String
 
   public init(data: String, publicKeys: [String], chainID: String) {
@@ -21,6 +21,17 @@ public final class EOSTransaction {
   }
 
   public func sign(password: String, keystore: Keystore) throws -> EOSSignResult {
+    return try EOSTransactionSigner(txs: [self], keystore: keystore, password: password).sign()[0]
+  }
+
+  /// Sign with the key of each public key, keys are supplied by the caller which has decrypted them.
+  func sign(with key: (String) -> EOSKey) -> EOSSignResult {
+    return sign(signingHashes(), with: key)
+  }
+
+  /// Hex of the SHA-256 of data, and the digest of chain ID, data and 32 zero bytes which keys sign.
+  /// Hashing touches no shared state, so it's safe on any thread.
+  func signingHashes() -> (hash: String, hashedTx: Data) {
     let hash = Hex.toBytes(data).sha256().toHexString()
 
     let toSign = NSMutableData()
@@ -28,22 +39,15 @@ public final class EOSTransaction {
     toSign.append(data.tk_dataFromHexString()!)
     toSign.append(Data(bytes: [UInt8](repeating: 0, count: 32)))
     let hashedTx = BTCSHA256(toSign as Data) as Data
+    return (hash, hashedTx)
+  }
 
-    let signs = try publicKeys.map { publicKey -> String in
-      let key: EOSKey
-      if let eosKeystore = keystore as? EOSKeystore {
-        let privateKey = try eosKeystore.decryptPrivateKey(from: publicKey, password: password)
-        key = EOSKey(privateKey: privateKey)
-      } else {
-        let legacyKeystore = keystore as! EOSLegacyKeystore
-        let wif = legacyKeystore.decryptWIF(password)
-        key = EOSKey(wif: wif)
-      }
-
-      return EOSTransaction.signatureBase58(data: key.sign(data: hashedTx))
+  func sign(_ hashes: (hash: String, hashedTx: Data), with key: (String) -> EOSKey) -> EOSSignResult {
+    let signs = publicKeys.map { publicKey -> String in
+      return EOSTransaction.signatureBase58(data: key(publicKey).sign(data: hashes.hashedTx))
     }
 
-    return EOSSignResult(hash: hash, signs: signs)
+    return EOSSignResult(hash: hashes.hash, signs: signs)
   }
 
   static func signatureBase58(data: Data) -> String {
@@ -20,13 +20,55 @@ class EOSTransactionSigner {
     self.password = password
   }
 
+  /// Unlock the keystore once, decrypt each distinct public key once, hash transactions in parallel, then sign them.
+  /// Signing reuses one EOSKey per public key, so it stays on this thread.
+  /// Decrypted keys are wiped before returning.
   public func sign() throws -> [EOSSignResult] {
-    guard keystore.verify(password: password) else {
-      throw PasswordError.incorrect
+    let unlocked = try keystore.unlock(password: password)
+    let keys = try decryptKeys(unlocked: unlocked)
+    defer { keys.values.forEach { $0.wipe() } }
+
+    var eosKeys = [String: EOSKey]()
+    let key: (String) -> EOSKey = { publicKey in
+      if let eosKey = eosKeys[publicKey] {
+        return eosKey
+      }
+      let eosKey = EOSKey(privateKey: keys[publicKey]!.bytes)
+      eosKeys[publicKey] = eosKey
+      return eosKey
+    }
+    guard txs.count > 1 else {
+      return txs.map { $0.sign(with: key) }
     }
 
-    return try txs.map { tx -> EOSSignResult in
-      return try tx.sign(password: password, keystore: keystore)
+    var hashes = [(hash: String, hashedTx: Data)?](repeating: nil, count: txs.count)
+    let hashesLock = NSLock()
+    DispatchQueue.concurrentPerform(iterations: txs.count) { i in
+      let txHashes = txs[i].signingHashes()
+      hashesLock.lock()
+      hashes[i] = txHashes
+      hashesLock.unlock()
+    }
+    return zip(txs, hashes).map { tx, txHashes in tx.sign(txHashes!, with: key) }
+  }
+
+  /// Private keys by public key for every key the transactions require.
+  /// Legacy keystores hold a single key which signs for any public key.
+  private func decryptKeys(unlocked: Crypto.Unlocked) throws -> [String: SecureBytes] {
+    var keys = [String: SecureBytes]()
+    var legacyKey: SecureBytes?
+    for publicKey in txs.flatMap({ $0.publicKeys }) where keys[publicKey] == nil {
+      if let eosKeystore = keystore as? EOSKeystore {
+        keys[publicKey] = SecureBytes(try eosKeystore.decryptPrivateKey(from: publicKey, unlocked: unlocked))
+      } else if let legacyKeystore = keystore as? EOSLegacyKeystore {
+        if legacyKey == nil {
+          legacyKey = SecureBytes(EOSKey.privateKey(from: legacyKeystore.decryptWIF(unlocked)))
+        }
+        keys[publicKey] = legacyKey
+      } else {
+        throw GenericError.operationUnsupported
+      }
     }
+    return keys
   }
 }
@@ -0,0 +1,60 @@
+//
+//  EIP55.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Mixed case checksum of Ethereum addresses, computed on ASCII bytes with one keccak256.
+/// https://github.com/ethereum/EIPs/blob/master/EIPS/eip-55.md
+public enum EIP55 {
+  /// Checksummed address with 0x prefix.
+  /// - Parameter address: 40 hex digits in any case, optionally prefixed with 0x.
+  /// - Returns: nil if address is not 40 hex digits.
+  public static func encode(_ address: String) -> String? {
+    return checksummed(digits(of: address)).map { "0x" + String(decoding: $0, as: UTF8.self) }
+  }
+
+  /// Whether the case of every letter matches the checksum, i.e. address is its own checksummed form.
+  public static func isValid(_ address: String) -> Bool {
+    let addressDigits = digits(of: address)
+    return checksummed(addressDigits).map { $0 == addressDigits } ?? false
+  }
+
+  private static func digits(of address: String) -> [UInt8] {
+    let utf8 = address.utf8
+    return Array(utf8.dropFirst(Hex.hasPrefix(address) ? 2 : 0))
+  }
+
+  /// Checksummed ASCII digits, nil unless digits are 40 hex characters.
+  private static func checksummed(_ digits: [UInt8]) -> [UInt8]? {
+    guard digits.count == 40 else {
+      return nil
+    }
+
+    var output = digits
+    for i in 0..<output.count {
+      switch output[i] {
+      case 0x30...0x39, 0x61...0x66: // 0-9, a-f
+        break
+      case 0x41...0x46: // A-F
+        output[i] += 0x20
+      default:
+        return nil
+      }
+    }
+
+    // Upper case a letter when its nibble of the hash of the lower case address is 8 or more
+    let hash = Encryptor.Keccak256().calculate(for: output)
+    for i in 0..<output.count where output[i] >= 0x61 {
+      let nibble = i % 2 == 0 ? hash[i / 2] >> 4 : hash[i / 2] & 0x0f
+      if nibble >= 8 {
+        output[i] -= 0x20
+      }
+    }
+    return output
+  }
+}
@@ -12,14 +12,16 @@ import CoreBitcoin
 public class ETHKey {
   private let rootPrivateKey: String
   let privateKey: String // For user daily use, adress/privateKey, via path "m/44'/60'/0'/0/index"
-  var address: String {
-    let btcKey = BTCKey(privateKey: privateKey.tk_dataFromHexString())!
-    return ETHKey.pubToAddress(btcKey.uncompressedPublicKey as Data)
-  }
+  let address: String
 
-  init(privateKey: String) {
+  /// - Returns: nil if privateKey is not a valid secp256k1 private key.
+  init?(privateKey: String) {
+    guard let address = ETHKey.address(ofPrivateKey: Hex.toBytes(privateKey)) else {
+      return nil
+    }
     rootPrivateKey = ""
     self.privateKey = privateKey
+    self.address = address
   }
 
   init(seed: Data, path: String) {
@@ -28,7 +30,10 @@ public class ETHKey {
     let components = path.components(separatedBy: "/")
     let index = UInt32(components.last!)!
     let account = rootKeychain.derivedKeychain(withPath: components.dropLast().joined(separator: "/"))!
-    privateKey = (account.key(at: index).privateKey as Data).tk_toHexString()
+    let key = account.key(at: index).privateKey as Data
+    privateKey = key.tk_toHexString()
+    // BIP32 derivation skips indexes whose key is invalid
+    address = ETHKey.address(ofPrivateKey: [UInt8](key))!
   }
 
   convenience init(mnemonic: Mnemonic, path: String) {
@@ -40,9 +45,35 @@ public class ETHKey {
     return ETHKey(mnemonic: mnemonic, path: path).address
   }
 
+  /// Addresses of keys at indexes under one account node, e.g. "m/44'/60'/0'/0".
+  /// Seed and account node are derived once for the whole range.
+  public static func mnemonicToAddresses(_ mnemonic: Mnemonic, accountPath: String, indexes: Range<UInt32>) -> [String] {
+    let seed = ETHMnemonic.deterministicSeed(from: mnemonic)
+    return addresses(seed: seed.tk_dataFromHexString()!, accountPath: accountPath, indexes: indexes)
+  }
+
+  static func addresses(seed: Data, accountPath: String, indexes: Range<UInt32>) -> [String] {
+    let account = BTCKeychain(seed: seed)!.derivedKeychain(withPath: accountPath)!
+    return indexes.map { index in
+      address(ofPrivateKey: [UInt8](account.key(at: index).privateKey as Data))!
+    }
+  }
+
   public static func pubToAddress(_ publicKey: Data) -> String {
-    let stringToEncrypt = publicKey.tk_toHexString().tk_substring(from: 2)
-    let sha3Keccak = Encryptor.Keccak256().encrypt(hex: stringToEncrypt)
-    return sha3Keccak.tk_substring(from: 24)
+    return address(ofPublicKey: [UInt8](publicKey))
+  }
+
+  /// Address of a 65 bytes uncompressed public key: last 20 bytes of keccak256 of the key without its 0x04 prefix.
+  /// Keccak runs natively in TKHash.c straight off the key's buffer, skipping the prefix in place.
+  static func address(ofPublicKey publicKey: [UInt8]) -> String {
+    var hash = [UInt8](repeating: 0, count: 32)
+    publicKey.withUnsafeBufferPointer { key in
+      tk_keccak256(key.baseAddress! + 1, key.count - 1, &hash)
+    }
+    return Hex.hex(from: Array(hash.suffix(20)))
+  }
+
+  static func address(ofPrivateKey privateKey: [UInt8]) -> String? {
+    return Encryptor.Secp256k1.publicKey(of: privateKey).map { address(ofPublicKey: $0) }
   }
 }
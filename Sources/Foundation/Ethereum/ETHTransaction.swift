@@ -13,6 +13,7 @@ public final class ETHTransaction: NSObject {
   private var chainID: Int
   let nonce, gasPrice, gasLimit, to, value, data: String
   var v, r, s: String
+  private let baseFields: [[UInt8]] // Serialized nonce to data, parsed once from raw
 
   /**
    Construct a transaction with raw data
@@ -34,6 +35,7 @@ public final class ETHTransaction: NSObject {
     v           = ETHTransaction.parse(raw, "v")
     r           = ETHTransaction.parse(raw, "r")
     s           = ETHTransaction.parse(raw, "s")
+    baseFields  = ETHTransaction.parseFields(nonce: nonce, gasPrice: gasPrice, gasLimit: gasLimit, to: to, value: value, data: data)
 
     if v.isEmpty && chainID > 0 {
       v = String(chainID)
@@ -50,20 +52,17 @@ public final class ETHTransaction: NSObject {
 
   /// - Returns: Signed TX, always prefixed with 0x
   public var signedTx: String {
-    return RLP.encode(serialize())
+    return Hex.hex(from: encoded)
   }
 
   /// Should only called after signing
   public var signedResult: TransactionSignedResult {
-    return TransactionSignedResult(signedTx: signedTx, txHash: signingHash)
-  }
-
-  private var signingData: String {
-    return RLP.encode(serialize())
+    let encoded = self.encoded
+    return TransactionSignedResult(signedTx: Hex.hex(from: encoded), txHash: ETHTransaction.hash(encoded))
   }
 
   var signingHash: String {
-    return Encryptor.Keccak256().encrypt(hex: signingData).add0xIfNeeded()
+    return ETHTransaction.hash(encoded)
   }
 
   /// Sign transaction with private key
@@ -71,7 +70,22 @@ public final class ETHTransaction: NSObject {
   ///     - privateKey: The private key from the keystore to sign the transaction.
   /// - Returns: dictionary [v, r, s] (all as String)
   public func sign(with privateKey: String) -> [String: String] {
-    let result = Encryptor.Secp256k1().sign(key: privateKey, message: signingHash)
+    return sign(with: Encryptor.Secp256k1.Signer(key: privateKey))
+  }
+
+  /// Sign many transactions with one private key, which is parsed and verified only once.
+  /// - Returns: Signed results in the same order as transactions.
+  public static func sign(_ transactions: [ETHTransaction], with privateKey: String) -> [TransactionSignedResult] {
+    let signer = Encryptor.Secp256k1.Signer(key: privateKey)
+    return transactions.map { tx in
+      _ = tx.sign(with: signer)
+      return tx.signedResult
+    }
+  }
+
+  private func sign(with signer: Encryptor.Secp256k1.Signer?) -> [String: String] {
+    let digest = Encryptor.Keccak256().calculate(for: encoded)
+    let result = signer?.sign(hash: digest) ?? Encryptor.Secp256k1.failureSignResult
 
     v = encodeV(result.recid)
     r = result.signature.tk_substring(to: 64)
@@ -92,21 +106,36 @@ public final class ETHTransaction: NSObject {
 
 // Parse and construct values
 private extension ETHTransaction {
-  func serialize() -> [BigNumber] {
-    let base: [BigNumber] = [
+  /// RLP of all fields. Before signing with a chain ID this is the EIP 155 signing data.
+  var encoded: [UInt8] {
+    return RLP.encode(.list(serialize().map { .bytes($0) }))
+  }
+
+  func serialize() -> [[UInt8]] {
+    if isSigned {
+      return baseFields + [
+        BigNumber.parse(v).serialize(),
+        BigNumber.parse(r).serialize(),
+        BigNumber.parse(s).serialize()
+      ]
+    } else {
+      return baseFields
+    }
+  }
+
+  static func parseFields(nonce: String, gasPrice: String, gasLimit: String, to: String, value: String, data: String) -> [[UInt8]] {
+    return [
       BigNumber.parse(nonce),
       BigNumber.parse(gasPrice),
       BigNumber.parse(gasLimit),
       BigNumber.parse(to, padding: true),  // Address
       BigNumber.parse(value),
       BigNumber.parse(data, padding: true) // Binary
-    ]
+    ].map { $0.serialize() }
+  }
 
-    if isSigned {
-      return base + [BigNumber.parse(v), BigNumber.parse(r), BigNumber.parse(s)]
-    } else {
-      return base
-    }
+  static func hash(_ encoded: [UInt8]) -> String {
+    return Hex.hex(from: Encryptor.Keccak256().calculate(for: encoded)).add0xIfNeeded()
   }
 
   static func parse(_ data: [String: String], _ key: String) -> String {
@@ -7,7 +7,6 @@
 //
 
 import Foundation
-import CommonCrypto
 
 public typealias Mnemonic = String
 public typealias MnemonicSeed = String // Hex encoded seed
@@ -15,6 +14,8 @@ public typealias MnemonicSeed = String // Hex encoded seed
 // Implimentation of BIP-39 style mnemonic codes for use with generating deterministic keys.
 // https://github.com/bitcoin/bips/blob/master/bip-0039.mediawiki
 class ETHMnemonic {
+  static let seedIterations = 2048
+
   let mnemonic: Mnemonic
   let seed: MnemonicSeed
 
@@ -36,31 +37,7 @@ class ETHMnemonic {
 
 extension ETHMnemonic {
   class func generate(from seed: MnemonicSeed) -> Mnemonic {
-    let seedData = seed.tk_dataFromHexString()!
-    var hash = Data(count: Int(CC_SHA256_DIGEST_LENGTH))
-    hash.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) -> Void in
-      CC_SHA256(seedData.bytes, CC_LONG(seedData.count), bytes)
-    }
-
-    let checksumBits = hash.tk_hexToBitArray()
-    var seedBits = seedData.tk_hexToBitArray()
-
-    // Append the appropriate checksum bits to the seed
-    for i in 0 ..< seedBits.count / 32 {
-      seedBits.append(checksumBits[i])
-    }
-
-    let dictionary = MnemonicDictionary.dictionary
-
-    // Split into groups of 11, and change to numbers
-    var words = [String]()
-    for i in 0 ..< seedBits.count / 11 {
-      let subBits = (seedBits[i * 11 ..< i * 11 + 11]).map { String($0) }
-      let index = strtol(subBits.joined(separator: ""), nil, 2)
-      words.append(dictionary[index])
-    }
-
-    return words.joined(separator: " ")
+    return try! MnemonicCodec.words(from: Hex.toBytes(seed)).joined(separator: " ")
   }
 
   // To create a binary seed from the mnemonic, use the PBKDF2 function with a mnemonic sentence (in UTF-8 NFKD)
@@ -74,23 +51,8 @@ extension ETHMnemonic {
     let normalizedPassphrase = String(data: passphrase.data(using: .ascii, allowLossyConversion: true)!, encoding: .ascii)!
     let salt = ("mnemonic" + normalizedPassphrase).data(using: .ascii, allowLossyConversion: false)!
 
-    let derivedKeyLen = Int(CC_SHA512_DIGEST_LENGTH)
-    var derivedKey = Data(count: derivedKeyLen)
-    derivedKey.withUnsafeMutableBytes { (bytes: UnsafeMutablePointer<UInt8>) -> Void in
-      CCKeyDerivationPBKDF(
-        UInt32(kCCPBKDF2),
-        dataString,
-        dataString.count,
-        salt.bytes,
-        salt.count,
-        UInt32(kCCPRFHmacAlgSHA512),
-        2048,
-        bytes,
-        derivedKeyLen
-      )
-    }
-
-    return derivedKey.tk_toHexString()
+    let derivedKey = Encryptor.PBKDF2.hmacSHA512(password: Array(dataString.utf8), salt: salt.bytes, iterations: seedIterations)
+    return Hex.hex(from: derivedKey)
   }
 
   // Strength: divisible by 32
@@ -0,0 +1,87 @@
+//
+//  MnemonicCodec.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+import CryptoSwift
+
+/// BIP39 conversion between entropy and English words.
+/// 11-bit word indexes are packed into and out of bytes through an integer bit buffer.
+struct MnemonicCodec {
+  static let validWordCounts = [12, 15, 18, 21, 24]
+  private static let bitsPerWord = 11
+  private static let wordMask: UInt32 = 0x7ff
+
+  /// Entropy must be 16 to 32 bytes, divisible by 4.
+  static func words(from entropy: [UInt8]) throws -> [String] {
+    guard entropy.count >= 16 && entropy.count <= 32 && entropy.count % 4 == 0 else {
+      throw MnemonicError.lengthInvalid
+    }
+
+    let dictionary = MnemonicDictionary.dictionary
+    let checksumBits = entropy.count / 4
+    var words = [String]()
+    words.reserveCapacity((entropy.count * 8 + checksumBits) / bitsPerWord)
+
+    var buffer: UInt32 = 0
+    var bufferBits = 0
+    func push(_ value: UInt8, bits: Int) {
+      buffer = buffer << UInt32(bits) | UInt32(value)
+      bufferBits += bits
+      if bufferBits >= bitsPerWord {
+        bufferBits -= bitsPerWord
+        words.append(dictionary[Int(buffer >> UInt32(bufferBits) & wordMask)])
+        buffer &= (1 << UInt32(bufferBits)) - 1
+      }
+    }
+
+    for byte in entropy {
+      push(byte, bits: 8)
+    }
+    push(checksum(of: entropy, bits: checksumBits), bits: checksumBits)
+    return words
+  }
+
+  /// Entropy of the words, checking count, words and checksum.
+  /// - Throws: MnemonicError.lengthInvalid, MnemonicError.wordInvalid or MnemonicError.checksumInvalid
+  static func entropy<S: StringProtocol>(from words: [S]) throws -> [UInt8] {
+    guard validWordCounts.contains(words.count) else {
+      throw MnemonicError.lengthInvalid
+    }
+
+    let checksumBits = words.count * bitsPerWord / 33
+    let entropyLength = (words.count * bitsPerWord - checksumBits) / 8
+    var entropy = [UInt8]()
+    entropy.reserveCapacity(entropyLength)
+
+    var buffer: UInt32 = 0
+    var bufferBits = 0
+    for word in words {
+      guard let index = MnemonicDictionary.index(of: String(word)) else {
+        throw MnemonicError.wordInvalid
+      }
+      buffer = buffer << UInt32(bitsPerWord) | UInt32(index)
+      bufferBits += bitsPerWord
+      while bufferBits >= 8 && entropy.count < entropyLength {
+        bufferBits -= 8
+        entropy.append(UInt8(truncatingIfNeeded: buffer >> UInt32(bufferBits)))
+        buffer &= (1 << UInt32(bufferBits)) - 1
+      }
+    }
+
+    // What remains in buffer is the checksum
+    guard bufferBits == checksumBits && UInt8(buffer) == checksum(of: entropy, bits: checksumBits) else {
+      throw MnemonicError.checksumInvalid
+    }
+    return entropy
+  }
+
+  /// Leading bits of SHA-256 of the entropy.
+  private static func checksum(of entropy: [UInt8], bits: Int) -> UInt8 {
+    return entropy.sha256()[0] >> UInt8(8 - bits)
+  }
+}
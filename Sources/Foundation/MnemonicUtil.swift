@@ -16,7 +16,25 @@ struct MnemonicUtil {
 
   static func generateMnemonic() -> String {
     let entropy = Data.tk_random(of: 16)
-    let words = BTCMnemonic(entropy: entropy, password: "", wordListType: .english).words as! [String]
-    return words.joined(separator: " ")
+    return try! MnemonicCodec.words(from: entropy.bytes).joined(separator: " ")
+  }
+
+  /// BIP39 seed of the mnemonic with empty passphrase.
+  /// - Throws: MnemonicError.wordInvalid
+  static func seed(from mnemonic: Mnemonic) throws -> Data {
+    let words = mnemonic.split(separator: " ")
+    guard (try? MnemonicCodec.entropy(from: words)) != nil else {
+      throw MnemonicError.wordInvalid
+    }
+
+    let sentence = words.joined(separator: " ").decomposedStringWithCompatibilityMapping
+    let seed = Encryptor.PBKDF2.hmacSHA512(password: Array(sentence.utf8), salt: Array("mnemonic".utf8), iterations: ETHMnemonic.seedIterations)
+    return Data(bytes: seed)
+  }
+
+  /// Seeds of several mnemonics, derived concurrently.
+  /// - Throws: MnemonicError.wordInvalid if any mnemonic is invalid
+  static func seeds(from mnemonics: [Mnemonic]) throws -> [Data] {
+    return try mnemonics.tk_concurrentMap { try seed(from: $0) }
   }
 }
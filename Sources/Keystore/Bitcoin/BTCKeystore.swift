@@ -30,26 +30,30 @@ struct BTCKeystore: Keystore, WIFCrypto {
 
   // MARK: - JSON
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
     guard
-      let cryptoJson = (json["crypto"] as? JSONObject) ?? (json["Crypto"] as? JSONObject),
-      json["version"] as? Int == version
+      let cryptoFields = fields.object("crypto") ?? fields.object("Crypto"),
+      fields.int("version") == version
     else {
       throw KeystoreError.invalid
     }
 
-    id = (json["id"] as? String) ?? BTCKeystore.generateKeystoreId()
-    address = json["address"] as? String ?? ""
-    crypto = try Crypto(json: cryptoJson)
+    id = fields.string("id") ?? BTCKeystore.generateKeystoreId()
+    address = fields.string("address") ?? ""
+    crypto = try Crypto(fields: cryptoFields)
 
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .btc, source: .keystore)
     }
   }
 
-  func decryptWIF(_ password: String) -> String {
-    let wif = crypto.privateKey(password: password).tk_fromHexString()
+  func decryptWIF(_ unlocked: Crypto.Unlocked) -> String {
+    let wif = unlocked.privateKey().tk_fromHexString()
     let key = BTCKey(wif: wif)!
     return meta.isMainnet ? key.wif : key.wifTestnet
   }
@@ -27,20 +27,19 @@ public struct BTCMnemonicKeystore: Keystore, EncMnemonicKeystore, XPrvCrypto {
   let xpub: String
 
   init(password: String, mnemonic: Mnemonic, path: String, metadata: WalletMeta, id: String? = nil) throws {
-    version = BTCMnemonicKeystore.defaultVersion
-    self.id = id ?? BTCMnemonicKeystore.generateKeystoreId()
-
     var realMnemonic = mnemonic
     if mnemonic.isEmpty {
       realMnemonic = ETHMnemonic().mnemonic
     }
 
-    mnemonicPath = path
+    try self.init(password: password, mnemonic: realMnemonic, seed: try MnemonicUtil.seed(from: realMnemonic), path: path, metadata: metadata, id: id)
+  }
 
-    guard let btcMnemonic = BTCMnemonic(words: realMnemonic.split(separator: " "), password: "", wordListType: .english),
-      let seedData = btcMnemonic.seed else {
-      throw MnemonicError.wordInvalid
-    }
+  /// Init with the seed already computed from mnemonic.
+  init(password: String, mnemonic realMnemonic: Mnemonic, seed seedData: Data, path: String, metadata: WalletMeta, id: String? = nil) throws {
+    version = BTCMnemonicKeystore.defaultVersion
+    self.id = id ?? BTCMnemonicKeystore.generateKeystoreId()
+    mnemonicPath = path
 
     let btcNetwork = metadata.isMainnet ? BTCNetwork.mainnet() : BTCNetwork.testnet()
     guard let masterKeychain = BTCKeychain(seed: seedData, network: btcNetwork),
@@ -82,20 +81,24 @@ public struct BTCMnemonicKeystore: Keystore, EncMnemonicKeystore, XPrvCrypto {
   }
 
   init(json: JSONObject) throws {
-    version = (json["version"] as? Int) ?? BTCMnemonicKeystore.defaultVersion
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
+    version = fields.int("version") ?? BTCMnemonicKeystore.defaultVersion
 
-    guard let cryptoJSON = json["crypto"] as? JSONObject else {
+    guard let cryptoFields = fields.object("crypto") else {
       throw KeystoreError.invalid
     }
-    crypto = try Crypto(json: cryptoJSON)
+    crypto = try Crypto(fields: cryptoFields)
 
     guard
-      let id = json["id"] as? String,
-      let mnemonicPath = json["mnemonicPath"] as? String,
-      let encMnemonicJSON = json["encMnemonic"] as? JSONObject,
-      let encMnemonic = EncryptedMessage(json: encMnemonicJSON),
-      let address = json["address"] as? String,
-      let xpub = json["xpub"] as? String else {
+      let id = fields.string("id"),
+      let mnemonicPath = fields.string("mnemonicPath"),
+      let encMnemonicFields = fields.object("encMnemonic"),
+      let encMnemonic = EncryptedMessage(fields: encMnemonicFields),
+      let address = fields.string("address"),
+      let xpub = fields.string("xpub") else {
       throw KeystoreError.invalid
     }
     self.id = id
@@ -104,8 +107,8 @@ public struct BTCMnemonicKeystore: Keystore, EncMnemonicKeystore, XPrvCrypto {
     self.address = address
     self.xpub = xpub
 
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .btc, source: .newIdentity)
     }
@@ -172,20 +175,15 @@ extension BTCMnemonicKeystore {
 extension BTCMnemonicKeystore {
   
   public static var scriptDerivedPathCache: [String: String] = [String: String]()
+  private static let scriptDerivedPathCacheLock = NSLock()
   
   public static func findUtxoKeyByScript(_ script: String, at keychain: BTCKeychain, isSegWit: Bool) -> BTCKey? {
     
-    if let derivedPath = scriptDerivedPathCache[script] {
+    if let derivedPath = cachedDerivedPath(of: script) {
       return keychain.key(withPath: "/\(derivedPath)")
     } else {
-      let scriptBytes = Hex.toBytes(script)
-      let targetHash160: Data
-      if isSegWit {
-        // p2pkh script = HASH160(1byte) (1byte dataLength) ab68025513c3dbd2f7b92a94e0581f5d50f654e7(20byte reedmScript hash160) EQUALVERIFY CHECKSIG
-        targetHash160 = Data(bytes: scriptBytes[2...21])
-      } else {
-        // p2sh-p2wpkh script = DUP(1byte) HASH160(1byte) (1byte dataLength) ab68025513c3dbd2f7b92a94e0581f5d50f654e7(20byte pk hash160) EQUALVERIFY CHECKSIG
-        targetHash160 = Data(bytes: scriptBytes[3...22])
+      guard let targetHash160 = hash160(ofScript: script, isSegWit: isSegWit) else {
+        return nil
       }
       
       var foundKey: BTCKey?
@@ -194,14 +192,14 @@ extension BTCMnemonicKeystore {
         let receiveKeyHash160 = hashPubKey(receiveKey.publicKey! as Data, isSegWit: isSegWit)
         if (receiveKeyHash160 as Data) == targetHash160 {
           foundKey = receiveKey
-          scriptDerivedPathCache[script] = "0/\(i)"
+          cacheDerivedPath("0/\(i)", of: script)
           break
         }
         
         let changeKey = keychain.key(withPath: "/1/\(i)")!
         let changeKeyHash160 = hashPubKey(changeKey.publicKey! as Data, isSegWit: isSegWit)
         if (changeKeyHash160 as Data) == targetHash160 {
-          scriptDerivedPathCache[script] = "1/\(i)"
+          cacheDerivedPath("1/\(i)", of: script)
           foundKey = changeKey
           break
         }
@@ -210,14 +208,41 @@ extension BTCMnemonicKeystore {
     }
   }
   
+  /// Hash160 a P2SH-P2WPKH or P2PKH script pays to, nil if script is too short.
+  static func hash160(ofScript script: String, isSegWit: Bool) -> Data? {
+    let scriptBytes = Hex.toBytes(script)
+    if isSegWit {
+      // p2sh-p2wpkh script = HASH160(1byte) (1byte dataLength) 20byte redeem script hash160 EQUAL
+      return scriptBytes.count >= 22 ? Data(bytes: scriptBytes[2...21]) : nil
+    } else {
+      // p2pkh script = DUP(1byte) HASH160(1byte) (1byte dataLength) 20byte pk hash160 EQUALVERIFY CHECKSIG
+      return scriptBytes.count >= 23 ? Data(bytes: scriptBytes[3...22]) : nil
+    }
+  }
+
+  static func cachedDerivedPath(of script: String) -> String? {
+    scriptDerivedPathCacheLock.lock()
+    defer { scriptDerivedPathCacheLock.unlock() }
+    return scriptDerivedPathCache[script]
+  }
+
+  static func cacheDerivedPath(_ path: String, of script: String) {
+    scriptDerivedPathCacheLock.lock()
+    scriptDerivedPathCache[script] = path
+    scriptDerivedPathCacheLock.unlock()
+  }
+  
+  /// OP_0 and the 20 bytes push starting the P2WPKH redeem script a P2SH-P2WPKH output pays to.
+  static let p2wpkhRedeemScriptPrefix: [UInt8] = [0x00, 0x14]
+
   public static func hashPubKey(_ data: Data, isSegWit: Bool) -> Data {
-    let hash160 = BTCHash160(data)!
+    let hash160 = Encryptor.Hash.hash160(data)
     if isSegWit {
-      var redeemScript = "0x0014".tk_dataFromHexString()!
-      redeemScript.append(hash160 as Data)
-      return BTCHash160(redeemScript as Data) as Data
+      var redeemScript = Data(bytes: p2wpkhRedeemScriptPrefix)
+      redeemScript.append(hash160)
+      return Encryptor.Hash.hash160(redeemScript)
     } else {
-      return hash160 as Data
+      return hash160
     }
   }
 
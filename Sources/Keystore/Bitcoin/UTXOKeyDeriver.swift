@@ -0,0 +1,196 @@
+//
+//  UTXOKeyDeriver.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+import CommonCrypto
+import CoreBitcoin
+
+/// Derives the keys signing a transaction's inputs from an HD account keychain.
+/// Inputs on the same path share one key, and inputs without derived path are looked up by script in one scan for all of them.
+/// Leaves of the external and change chains are derived concurrently on libsecp256k1 and CommonCrypto,
+/// then wrapped into BTCKey one by one on the calling thread.
+final class UTXOKeyDeriver {
+  static let minimumChunkSize = 16
+  /// Indexes scanned on each chain, as findUtxoKeyByScript does.
+  static let scanLimit = 65536
+
+  private let keychain: BTCKeychain
+  private let isSegWit: Bool
+  /// External (/0) and change (/1) chains, empty if the keychain holds no private key.
+  private let chains: [Chain]
+
+  init(keychain: BTCKeychain, isSegWit: Bool) {
+    self.keychain = keychain
+    self.isSegWit = isSegWit
+    let chains = (0..<2).compactMap { Chain(keychain.derivedKeychain(at: UInt32($0))) }
+    self.chains = chains.count == 2 ? chains : []
+  }
+
+  /// - Returns: Key of each UTXO, in order.
+  /// - Throws: GenericError.paramError if a UTXO has no derived path and its script doesn't belong to the keychain.
+  func keys(for utxos: [UTXO]) throws -> [BTCKey] {
+    var paths = utxos.map { $0.derivedPath ?? BTCMnemonicKeystore.cachedDerivedPath(of: $0.scriptPubKey) }
+    let unresolved = Set(zip(utxos, paths).filter { $0.1 == nil }.map { $0.0.scriptPubKey })
+    if !unresolved.isEmpty {
+      let found = scan(for: unresolved)
+      paths = zip(utxos, paths).map { utxo, path in path ?? found[utxo.scriptPubKey] }
+    }
+
+    let uniquePaths = Array(Set(paths.compactMap { $0 }))
+    let keys = deriveKeys(at: uniquePaths)
+    return try paths.map { path in
+      guard let path = path, let key = keys[path] else {
+        throw GenericError.paramError
+      }
+      return key
+    }
+  }
+
+  private func deriveKeys(at paths: [String]) -> [String: BTCKey] {
+    var privateKeys = [[UInt8]?](repeating: nil, count: paths.count)
+    privateKeys.withUnsafeMutableBufferPointer { buffer in
+      let privateKeysBase = buffer.baseAddress!
+      perform(count: paths.count) { range in
+        for i in range {
+          privateKeysBase[i] = self.chainPrivateKey(at: paths[i])
+        }
+      }
+    }
+
+    // Everything below builds CoreBitcoin keys
+    var result = [String: BTCKey]()
+    for (path, privateKey) in zip(paths, privateKeys) {
+      let key: BTCKey?
+      if let privateKey = privateKey {
+        key = BTCKey(privateKey: Data(bytes: privateKey))
+      } else {
+        key = keychain.key(withPath: "/\(path)")
+      }
+      if let key = key {
+        key.isPublicKeyCompressed = true
+        result[path] = key
+      }
+    }
+    return result
+  }
+
+  /// Private key of a chain/index path, nil for any other path, which is left to the account keychain.
+  private func chainPrivateKey(at path: String) -> [UInt8]? {
+    let components = path.split(separator: "/")
+    guard components.count == 2, let chain = Int(components[0]), chains.indices.contains(chain),
+      let index = UInt32(components[1]), index <= BTCKeychainMaxIndex else {
+      return nil
+    }
+    return chains[chain].privateKey(at: index)
+  }
+
+  /// Find chain/index paths of scripts by scanning both chains in waves, until all are found or the limit is hit.
+  /// The first wave is one chunk per core and each next one doubles, so scripts at low indexes cost few derivations.
+  /// Paths found are added to the cache of findUtxoKeyByScript.
+  private func scan(for scripts: Set<String>) -> [String: String] {
+    var targets = [Data: String]()
+    for script in scripts {
+      if let hash160 = BTCMnemonicKeystore.hash160(ofScript: script, isSegWit: isSegWit) {
+        targets[hash160] = script
+      }
+    }
+
+    var found = [String: String]()
+    let foundLock = NSLock()
+    var waveSize = UTXOKeyDeriver.minimumChunkSize * ProcessInfo.processInfo.activeProcessorCount
+    var start = 0
+    while !chains.isEmpty && start < UTXOKeyDeriver.scanLimit && found.count < targets.count {
+      let end = min(start + waveSize, UTXOKeyDeriver.scanLimit)
+      perform(count: end - start) { range in
+        // Key of chain c at index i is the (2 * (i - range.lowerBound) + c)th, an index BIP32 skips hashes nothing
+        let chainCount = self.chains.count
+        let publicKeys = range.flatMap { i in self.chains.map { $0.publicKey(at: UInt32(start + i)) ?? Data() } }
+        let hashes = self.pubKeyHashes(publicKeys)
+        let digestSize = Encryptor.Hash.hash160Size
+        for n in publicKeys.indices {
+          if let script = targets[Data(bytes: hashes[(n * digestSize)..<((n + 1) * digestSize)])] {
+            foundLock.lock()
+            found[script] = "\(n % chainCount)/\(start + range.lowerBound + n / chainCount)"
+            foundLock.unlock()
+          }
+        }
+      }
+      start = end
+      waveSize *= 2
+    }
+
+    found.forEach { script, path in BTCMnemonicKeystore.cacheDerivedPath(path, of: script) }
+    return found
+  }
+
+  /// hashPubKey of each public key, packed 20 bytes each, hashed in two batches at most.
+  private func pubKeyHashes(_ publicKeys: [Data]) -> [UInt8] {
+    let digestSize = Encryptor.Hash.hash160Size
+    var hashes = [UInt8](repeating: 0, count: publicKeys.count * digestSize)
+    Encryptor.Hash.batchHash160(publicKeys, output: &hashes, concurrently: false)
+    guard isSegWit else {
+      return hashes
+    }
+
+    let redeemScripts = publicKeys.indices.map { i in
+      Data(bytes: BTCMnemonicKeystore.p2wpkhRedeemScriptPrefix + hashes[(i * digestSize)..<((i + 1) * digestSize)])
+    }
+    Encryptor.Hash.batchHash160(redeemScripts, output: &hashes, concurrently: false)
+    return hashes
+  }
+
+  private func perform(count: Int, body: (Range<Int>) -> Void) {
+    let chunks = min(count / UTXOKeyDeriver.minimumChunkSize, ProcessInfo.processInfo.activeProcessorCount)
+    if chunks <= 1 {
+      body(0..<count)
+      return
+    }
+    let chunkSize = (count + chunks - 1) / chunks
+    DispatchQueue.concurrentPerform(iterations: chunks) { chunk in
+      body((chunk * chunkSize)..<min(count, (chunk + 1) * chunkSize))
+    }
+  }
+}
+
+extension UTXOKeyDeriver {
+  /// Key material of one chain, to derive its non hardened children from any thread.
+  private struct Chain {
+    let privateKey: [UInt8]
+    let chainCode: [UInt8]
+    /// Compressed, the parent key every child's HMAC covers.
+    let publicKey: [UInt8]
+
+    init?(_ keychain: BTCKeychain?) {
+      guard let keychain = keychain, keychain.isPrivate, let key = keychain.key,
+        let privateKey = key.privateKey, let chainCode = keychain.chainCode else {
+        return nil
+      }
+      self.privateKey = (privateKey as Data).bytes
+      self.chainCode = chainCode.bytes
+      publicKey = (key.compressedPublicKey as Data).bytes
+    }
+
+    /// BIP32 CKDpriv: left half of HMAC-SHA512(chain code, public key || index) added to the private key.
+    /// - Returns: nil for the rare index BIP32 skips.
+    func privateKey(at index: UInt32) -> [UInt8]? {
+      let data = publicKey + [24, 16, 8, 0].map { UInt8(truncatingIfNeeded: index >> $0) }
+      var digest = [UInt8](repeating: 0, count: Int(CC_SHA512_DIGEST_LENGTH))
+      CCHmac(CCHmacAlgorithm(kCCHmacAlgSHA512), chainCode, chainCode.count, data, data.count, &digest)
+      defer {
+        for i in digest.indices {
+          digest[i] = 0
+        }
+      }
+      return Encryptor.Secp256k1.privateKey(privateKey, adding: Array(digest[0..<32]))
+    }
+
+    func publicKey(at index: UInt32) -> Data? {
+      return privateKey(at: index).flatMap { Encryptor.Secp256k1.publicKey(of: $0, compressed: true) }.map { Data(bytes: $0) }
+    }
+  }
+}
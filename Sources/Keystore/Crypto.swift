@@ -9,7 +9,7 @@
 import Foundation
 
 protocol Kdfparams {
-  init(json: JSONObject) throws
+  init(fields: KeystoreFields) throws
   func toJSON() -> JSONObject
   func derivedKey(for password: String) -> String
 }
@@ -33,7 +33,9 @@ public class Crypto {
   let kdfparams: Kdfparams // KDF-dependent static and dynamic parameters to the KDF function
   let mac: String // SHA3 (keccak-256) of the concatenation of the last 16 bytes of the derived key together with the full ciphertext
 
-  public var cachedDerivedKey = CachedDerivedKey(hashedPassword: "", derivedKey: "")
+  private var cachedDerivedKey = CachedDerivedKey(hashedPassword: "", derivedKey: "")
+  private let derivedKeyCacheLock = NSLock()
+  private var derivedKeyCacheUsers = 0
 
   /**
    Create an Crypto instance.
@@ -59,13 +61,17 @@ public class Crypto {
     mac = Encryptor.Keccak256().encrypt(hex: macHex)
   }
 
-  init(json: JSONObject) throws {
-    guard let ciphertext = json["ciphertext"] as? String,
-      let cipherparamsJson = json["cipherparams"] as? JSONObject,
-      let kdfparamsJson = json["kdfparams"] as? JSONObject,
-      let mac = json["mac"] as? String,
-      let cipherStr = json["cipher"] as? String,
-      let kdfStr = json["kdf"] as? String
+  convenience init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
+    guard let ciphertext = fields.string("ciphertext"),
+      let cipherparamsFields = fields.object("cipherparams"),
+      let kdfparamsFields = fields.object("kdfparams"),
+      let mac = fields.string("mac"),
+      let cipherStr = fields.string("cipher"),
+      let kdfStr = fields.string("kdf")
     else {
       throw KeystoreError.invalid
     }
@@ -82,9 +88,9 @@ public class Crypto {
 
     self.cipher = cipher
     self.ciphertext = ciphertext
-    cipherparams = try Cipherparams(json: cipherparamsJson)
+    cipherparams = Cipherparams(fields: cipherparamsFields)
     self.kdf = kdf
-    kdfparams = try kdfparamsClass.init(json: kdfparamsJson)
+    kdfparams = try kdfparamsClass.init(fields: kdfparamsFields)
     self.mac = mac
   }
 
@@ -133,7 +139,7 @@ public extension Crypto {
 extension Crypto {
   // Derive key with password
   func derivedKey(with password: String) -> String {
-    if let cached = cachedDerivedKey.fetch(password: password) {
+    if let cached = fetchCachedDerivedKey(password: password) {
       return cached
     } else {
       return kdfparams.derivedKey(for: password)
@@ -141,17 +147,45 @@ extension Crypto {
   }
 
   func cachedDerivedKey(with password: String) -> String {
-    if let cached = cachedDerivedKey.fetch(password: password) {
+    if let cached = fetchCachedDerivedKey(password: password) {
       return cached
     } else {
-      let key = derivedKey(with: password)
+      let key = kdfparams.derivedKey(for: password)
+      derivedKeyCacheLock.lock()
       cachedDerivedKey.cache(password: password, derivedKey: key)
+      derivedKeyCacheLock.unlock()
       return key
     }
   }
 
   func clearDerivedKey() {
+    derivedKeyCacheLock.lock()
     cachedDerivedKey.clear()
+    derivedKeyCacheLock.unlock()
+  }
+
+  /// Serve the derived key of password from cache while body runs.
+  /// Concurrent callers share the cache, it's cleared once the last of them returns.
+  func withCachedDerivedKey<T>(password: String, derivedKey: String, _ body: () throws -> T) rethrows -> T {
+    derivedKeyCacheLock.lock()
+    cachedDerivedKey.cache(password: password, derivedKey: derivedKey)
+    derivedKeyCacheUsers += 1
+    derivedKeyCacheLock.unlock()
+    defer {
+      derivedKeyCacheLock.lock()
+      derivedKeyCacheUsers -= 1
+      if derivedKeyCacheUsers == 0 {
+        cachedDerivedKey.clear()
+      }
+      derivedKeyCacheLock.unlock()
+    }
+    return try body()
+  }
+
+  private func fetchCachedDerivedKey(password: String) -> String? {
+    derivedKeyCacheLock.lock()
+    defer { derivedKeyCacheLock.unlock() }
+    return cachedDerivedKey.fetch(password: password)
   }
 
   // Create encryptor with key and nonce
@@ -161,12 +195,46 @@ extension Crypto {
   }
 }
 
+// MARK: Unlock
+extension Crypto {
+  /// Key derived from password, shared by every decryption under this crypto so that KDF runs only once.
+  struct Unlocked {
+    let crypto: Crypto
+    let derivedKey: String
+
+    // ciphertext -> private key
+    func privateKey() -> String {
+      let cipherKey = derivedKey.tk_substring(to: 32)
+      return Encryptor.AES128(key: cipherKey, iv: crypto.cipherparams.iv, mode: crypto.aesMode()).decrypt(hex: crypto.ciphertext)
+    }
+
+    func decrypt(_ message: EncryptedMessage) -> String {
+      let encryptor = crypto.encryptor(from: derivedKey.tk_substring(to: 32), nonce: message.nonce)
+      return encryptor.decrypt(hex: message.encStr)
+    }
+  }
+
+  /// Derive key with password and verify it with MAC.
+  /// - Throws: PasswordError.incorrect if MAC doesn't match.
+  func unlock(password: String) throws -> Unlocked {
+    let key = derivedKey(with: password)
+    guard macForDerivedKey(key: key).lowercased() == mac.lowercased() else {
+      throw PasswordError.incorrect
+    }
+    return Unlocked(crypto: self, derivedKey: key)
+  }
+
+  /// Same as `unlock(password:)` without verifying MAC, for callers that have verified the password.
+  func unverifiedUnlock(password: String) -> Unlocked {
+    return Unlocked(crypto: self, derivedKey: derivedKey(with: password))
+  }
+}
+
 // MARK: Functional API
 extension Crypto {
   // ciphertext -> private key
   func privateKey(password: String) -> String {
-    let cipherKey = derivedKey(with: password).tk_substring(to: 32)
-    return Encryptor.AES128(key: cipherKey, iv: cipherparams.iv, mode: aesMode()).decrypt(hex: ciphertext)
+    return unverifiedUnlock(password: password).privateKey()
   }
 
   func macFrom(password: String) -> String {
@@ -202,8 +270,8 @@ extension Crypto {
       iv = Data.tk_random(of: 16).tk_toHexString()
     }
 
-    init(json: JSONObject) throws {
-      iv = (json["iv"] as? String) ?? ""
+    init(fields: KeystoreFields) {
+      iv = fields.string("iv") ?? ""
     }
 
     func toJSON() -> JSONObject {
@@ -218,11 +286,11 @@ extension Crypto {
     let prf: String // a pseudorandom function of two parameters with output length hLen (e.g. a keyed HMAC)
     let salt: String // salt passed to PBKDF
 
-    init(json: JSONObject) throws {
-      guard let c = json["c"] as? Int,
-        let dklen = json["dklen"] as? Int,
-        let prf = json["prf"] as? String,
-        let salt = json["salt"] as? String
+    init(fields: KeystoreFields) throws {
+      guard let c = fields.int("c"),
+        let dklen = fields.int("dklen"),
+        let prf = fields.string("prf"),
+        let salt = fields.string("salt")
       else {
         throw KeystoreError.kdfParamsInvalid
       }
@@ -280,12 +348,12 @@ extension Crypto {
       self.salt = salt ?? Data.tk_random(of: 32).tk_toHexString()
     }
 
-    init(json: JSONObject) throws {
-      guard let dklen = json["dklen"] as? Int,
-        let n = json["n"] as? Int,
-        let r = json["r"] as? Int,
-        let p = json["p"] as? Int,
-        let salt = json["salt"] as? String
+    init(fields: KeystoreFields) throws {
+      guard let dklen = fields.int("dklen"),
+        let n = fields.int("n"),
+        let r = fields.int("r"),
+        let p = fields.int("p"),
+        let salt = fields.string("salt")
       else {
         throw KeystoreError.kdfParamsInvalid
       }
@@ -47,65 +47,78 @@ struct EOSKeystore: Keystore, EncMnemonicKeystore {
   }
 
   init(accountName: String = "", password: String, mnemonic: Mnemonic, path: String, permissions: [EOS.PermissionObject], metadata: WalletMeta, id: String? = nil) throws {
+    try self.init(accountName: accountName, password: password, mnemonic: mnemonic, seed: try MnemonicUtil.seed(from: mnemonic), path: path, permissions: permissions, metadata: metadata, id: id)
+  }
+
+  /// Init with the seed already computed from mnemonic.
+  init(accountName: String = "", password: String, mnemonic: Mnemonic, seed: Data, path: String, permissions: [EOS.PermissionObject], metadata: WalletMeta, id: String? = nil) throws {
     self.id = id ?? EOSKeystore.generateKeystoreId()
     address = try EOSAccountNameValidator(accountName).validate()
     mnemonicPath = path
     meta = metadata
 
-    let defaultKeys = try EOSKeystore.calculateDefaultKeys(mnemonic: mnemonic, path: path)
-    crypto = Crypto(password: password, privateKey: RandomIV.init().value, cacheDerivedKey: true)
+    let defaultKeys = try EOSKeystore.calculateDefaultKeys(seed: seed, path: path)
+    let crypto = Crypto(password: password, privateKey: RandomIV.init().value, cacheDerivedKey: true)
     let derivedKey = crypto.cachedDerivedKey(with: password)
     encMnemonic = EncryptedMessage.create(crypto: crypto, derivedKey: derivedKey, message: mnemonic.tk_toHexString())
     keyPathPrivates = try EOSKeystore.encryptKeyPaths(crypto: crypto, keyPaths: defaultKeys, permissions: permissions, derivedKey: derivedKey)
     crypto.clearDerivedKey()
+    self.crypto = crypto
   }
 
   // MARK: - JSON
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
     guard
-      let cryptoJson = (json["crypto"] as? JSONObject) ?? (json["Crypto"] as? JSONObject),
-      json["version"] as? Int == version
+      let cryptoFields = fields.object("crypto") ?? fields.object("Crypto"),
+      fields.int("version") == version
     else {
       throw KeystoreError.invalid
     }
 
-    id = (json["id"] as? String) ?? EOSKeystore.generateKeystoreId()
-    address = json["address"] as? String ?? ""
-    crypto = try Crypto(json: cryptoJson)
+    id = fields.string("id") ?? EOSKeystore.generateKeystoreId()
+    address = fields.string("address") ?? ""
+    crypto = try Crypto(fields: cryptoFields)
 
-    mnemonicPath = json["mnemonicPath"] as? String ?? ""
-    if let encMnemonicJSON = json["encMnemonic"] as? JSONObject, let encMnemonic = EncryptedMessage(json: encMnemonicJSON) {
+    mnemonicPath = fields.string("mnemonicPath") ?? ""
+    if let encMnemonicFields = fields.object("encMnemonic"), let encMnemonic = EncryptedMessage(fields: encMnemonicFields) {
       self.encMnemonic = encMnemonic
     }
 
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .btc, source: .keystore)
     }
 
-    if let keyPathPrivatesJSON = json["keyPathPrivates"] as? [JSONObject] {
-      keyPathPrivates = keyPathPrivatesJSON.compactMap { KeyPathPrivate(json: $0, hasMnemonic: mnemonicPath.isEmpty) }
+    if let keyPathPrivatesFields = fields.objects("keyPathPrivates") {
+      keyPathPrivates = keyPathPrivatesFields.compactMap { KeyPathPrivate(fields: $0, hasMnemonic: mnemonicPath.isEmpty) }
     }
   }
 
   func decryptPrivateKey(from publicKey: String, password: String) throws -> [UInt8] {
-    
-    guard verify(password: password) else {
-      throw PasswordError.incorrect
-    }
-    
+    return try decryptPrivateKey(from: publicKey, unlocked: unlock(password: password))
+  }
+
+  func decryptPrivateKey(from publicKey: String, unlocked: Crypto.Unlocked) throws -> [UInt8] {
     guard let keyPath = keyPathPrivates.first(where: { keyPathPrivate -> Bool in
       return publicKey == keyPathPrivate.publicKey
     }) else {
       throw EOSError.privatePublicNotMatch
     }
-    return keyPath.encrypted.decrypt(crypto: crypto, password: password).tk_dataFromHexString()!.bytes
+    return keyPath.encrypted.decrypt(with: unlocked).tk_dataFromHexString()!.bytes
   }
 
   func exportKeyPairs(_ password: String) -> [KeyPair] {
+    return exportKeyPairs(crypto.unverifiedUnlock(password: password))
+  }
+
+  func exportKeyPairs(_ unlocked: Crypto.Unlocked) -> [KeyPair] {
     return keyPathPrivates.map({ (keyPathPrivate) -> KeyPair in
-      let decrypted = keyPathPrivate.encrypted.decrypt(crypto: crypto, password: password)
+      let decrypted = keyPathPrivate.encrypted.decrypt(with: unlocked)
       let privateKey = EOSKey(privateKey: decrypted.tk_dataFromHexString()!.bytes)
       return KeyPair(privateKey: privateKey.wif, publicKey: keyPathPrivate.publicKey)
     })
@@ -126,13 +139,8 @@ struct EOSKeystore: Keystore, EncMnemonicKeystore {
 
 private extension EOSKeystore {
   /// Calculate and return [master, owner, active] keys.
-  static func calculateDefaultKeys(mnemonic: Mnemonic, path: String) throws -> [([UInt8], String?)] {
-    guard let btcMnemonic = BTCMnemonic(words: mnemonic.split(separator: " "), password: "", wordListType: .english),
-      let seedData = btcMnemonic.seed else {
-        throw MnemonicError.wordInvalid
-    }
-
-    guard let masterKeychain = BTCKeychain(seed: seedData) else {
+  static func calculateDefaultKeys(seed: Data, path: String) throws -> [([UInt8], String?)] {
+    guard let masterKeychain = BTCKeychain(seed: seed) else {
         throw GenericError.unknownError
     }
     return path.components(separatedBy: ",").map { p in
@@ -179,17 +187,17 @@ extension EOSKeystore {
       self.path = path
     }
 
-    init?(json: JSONObject, hasMnemonic: Bool) {
+    init?(fields: KeystoreFields, hasMnemonic: Bool) {
       guard
-        let encryptedJSON = json["privateKey"] as? JSONObject,
-        let encrypted = EncryptedMessage(json: encryptedJSON),
-        let publicKey = json["publicKey"] as? String
+        let encryptedFields = fields.object("privateKey"),
+        let encrypted = EncryptedMessage(fields: encryptedFields),
+        let publicKey = fields.string("publicKey")
       else {
           return nil
       }
-      let path = json["path"] as? String
+      let path = fields.string("path")
       let derivedMode: String
-      if let derivedModeFromJSON = json["derivedMode"] as? String {
+      if let derivedModeFromJSON = fields.string("derivedMode") {
           derivedMode = derivedModeFromJSON
       } else {
         derivedMode = hasMnemonic ? "IMPORTED" : "HD_SHA256"
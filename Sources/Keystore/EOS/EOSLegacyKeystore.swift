@@ -27,32 +27,40 @@ struct EOSLegacyKeystore: Keystore, WIFCrypto {
 
   // MARK: - JSON
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
     guard
-      let cryptoJson = (json["crypto"] as? JSONObject) ?? (json["Crypto"] as? JSONObject),
-      json["version"] as? Int == version
+      let cryptoFields = fields.object("crypto") ?? fields.object("Crypto"),
+      fields.int("version") == version
       else {
         throw KeystoreError.invalid
     }
 
-    id = (json["id"] as? String) ?? EOSKeystore.generateKeystoreId()
-    address = json["address"] as? String ?? ""
-    crypto = try Crypto(json: cryptoJson)
+    id = fields.string("id") ?? EOSKeystore.generateKeystoreId()
+    address = fields.string("address") ?? ""
+    crypto = try Crypto(fields: cryptoFields)
 
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .btc, source: .keystore)
     }
   }
 
-  func decryptWIF(_ password: String) -> String {
-    let wif = crypto.privateKey(password: password).tk_fromHexString()
+  func decryptWIF(_ unlocked: Crypto.Unlocked) -> String {
+    let wif = unlocked.privateKey().tk_fromHexString()
     let key = BTCKey(wif: wif)!
     return key.wif
   }
   
   func exportPrivateKeys(_ password: String) -> [KeyPair] {
-    let wif = crypto.privateKey(password: password).tk_fromHexString()
+    return exportPrivateKeys(crypto.unverifiedUnlock(password: password))
+  }
+
+  func exportPrivateKeys(_ unlocked: Crypto.Unlocked) -> [KeyPair] {
+    let wif = unlocked.privateKey().tk_fromHexString()
     let key = BTCKey(wif: wif)!
     let eosKey = EOSKey(wif: key.wif)
     let keyPair = KeyPair(privateKey: key.wif, publicKey: eosKey.publicKey)
@@ -19,7 +19,11 @@ struct EncryptedMessage {
   }
 
   init?(json: JSONObject) {
-    guard let encStr = json["encStr"] as? String, let nonce = json["nonce"] as? String else {
+    self.init(fields: .json(json))
+  }
+
+  init?(fields: KeystoreFields) {
+    guard let encStr = fields.string("encStr"), let nonce = fields.string("nonce") else {
       return nil
     }
     self.init(encStr: encStr, nonce: nonce)
@@ -37,9 +41,12 @@ struct EncryptedMessage {
 
   // use kdf with password to decrypt secert message
   func decrypt(crypto: Crypto, password: String) -> String {
-    let dk = crypto.derivedKey(with: password)
-    let encryptor = crypto.encryptor(from: dk.tk_substring(to: 32), nonce: nonce)
-    return encryptor.decrypt(hex: encStr)
+    return decrypt(with: crypto.unverifiedUnlock(password: password))
+  }
+
+  // decrypt with key already derived and verified
+  func decrypt(with unlocked: Crypto.Unlocked) -> String {
+    return unlocked.decrypt(self)
   }
 
   func toJSON() -> JSONObject {
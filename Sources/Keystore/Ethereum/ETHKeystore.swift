@@ -16,8 +16,12 @@ struct ETHKeystore: ExportableKeystore, PrivateKeyCrypto {
   var meta: WalletMeta
 
   // Import from private key
+  /// - Throws: PrivateKeyError.invalid if privateKey is not a valid secp256k1 private key
   init(password: String, privateKey: String, metadata: WalletMeta, id: String? = nil) throws {
-    address = ETHKey(privateKey: privateKey).address
+    guard let key = ETHKey(privateKey: privateKey) else {
+      throw PrivateKeyError.invalid
+    }
+    address = key.address
     crypto = Crypto(password: password, privateKey: privateKey)
     self.id = id ?? ETHKeystore.generateKeystoreId()
     meta = metadata
@@ -25,19 +29,23 @@ struct ETHKeystore: ExportableKeystore, PrivateKeyCrypto {
 
   // MARK: - JSON
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
     guard
-      let cryptoJson = (json["crypto"] as? JSONObject) ?? (json["Crypto"] as? JSONObject),
-      json["version"] as? Int == version
+      let cryptoFields = fields.object("crypto") ?? fields.object("Crypto"),
+      fields.int("version") == version
       else {
         throw KeystoreError.invalid
     }
 
-    id = (json["id"] as? String) ?? ETHKeystore.generateKeystoreId()
-    address = json["address"] as? String ?? ""
-    crypto = try Crypto(json: cryptoJson)
+    id = fields.string("id") ?? ETHKeystore.generateKeystoreId()
+    address = fields.string("address") ?? ""
+    crypto = try Crypto(fields: cryptoFields)
 
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .eth, source: .keystore)
     }
@@ -18,10 +18,18 @@ struct ETHMnemonicKeystore: ExportableKeystore, EncMnemonicKeystore, PrivateKeyC
   let mnemonicPath: String
 
   init(password: String, mnemonic: String, path: String, metadata: WalletMeta, id: String? = nil) throws {
+    try self.init(password: password, ethKey: ETHKey(mnemonic: mnemonic, path: path), mnemonic: mnemonic, path: path, metadata: metadata, id: id)
+  }
+
+  /// Init with the seed already computed from mnemonic.
+  init(password: String, mnemonic: String, seed: Data, path: String, metadata: WalletMeta, id: String? = nil) throws {
+    try self.init(password: password, ethKey: ETHKey(seed: seed, path: path), mnemonic: mnemonic, path: path, metadata: metadata, id: id)
+  }
+
+  private init(password: String, ethKey: ETHKey, mnemonic: String, path: String, metadata: WalletMeta, id: String?) throws {
     self.id = id ?? ETHMnemonicKeystore.generateKeystoreId()
     meta = metadata
 
-    let ethKey = ETHKey(mnemonic: mnemonic, path: path)
     crypto = Crypto(password: password, privateKey: ethKey.privateKey, cacheDerivedKey: true)
     encMnemonic = EncryptedMessage.create(crypto: crypto, derivedKey: crypto.cachedDerivedKey(with: password), message: mnemonic.tk_toHexString())
     crypto.clearDerivedKey()
@@ -30,24 +38,28 @@ struct ETHMnemonicKeystore: ExportableKeystore, EncMnemonicKeystore, PrivateKeyC
   }
 
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) throws {
     guard
-      let cryptoJson = (json["crypto"] as? JSONObject) ?? (json["Crypto"] as? JSONObject),
-      json["version"] as? Int == version,
-      let encMnemonicNode = json["encMnemonic"] as? JSONObject,
-      let mnemonicPath = json["mnemonicPath"] as? String
+      let cryptoFields = fields.object("crypto") ?? fields.object("Crypto"),
+      fields.int("version") == version,
+      let encMnemonicFields = fields.object("encMnemonic"),
+      let mnemonicPath = fields.string("mnemonicPath")
       else {
       throw KeystoreError.invalid
     }
 
-    id = (json["id"] as? String) ?? ETHMnemonicKeystore.generateKeystoreId()
+    id = fields.string("id") ?? ETHMnemonicKeystore.generateKeystoreId()
 
-    address = json["address"] as? String ?? ""
-    crypto = try Crypto(json: cryptoJson)
+    address = fields.string("address") ?? ""
+    crypto = try Crypto(fields: cryptoFields)
 
-    encMnemonic = EncryptedMessage(json: encMnemonicNode)!
+    encMnemonic = EncryptedMessage(fields: encMnemonicFields)!
     self.mnemonicPath = mnemonicPath
-    if let metaJSON = json[WalletMeta.key] as? JSONObject {
-      meta = try WalletMeta(json: metaJSON)
+    if let metaFields = fields.object(WalletMeta.key) {
+      meta = WalletMeta(fields: metaFields)
     } else {
       meta = WalletMeta(chain: .eth, source: .keystore)
     }
@@ -36,25 +36,58 @@ public struct IdentityKeystore {
   }
 
   func mnemonic(from password: String) throws -> String {
-    return String(data: encMnemonic.decrypt(crypto: crypto, password: password).tk_dataFromHexString()!, encoding: .utf8)!
+    return mnemonic(from: crypto.unverifiedUnlock(password: password))
+  }
+
+  func mnemonic(from unlocked: Crypto.Unlocked) -> String {
+    return String(data: encMnemonic.decrypt(with: unlocked).tk_dataFromHexString()!, encoding: .utf8)!
+  }
+
+  /// Derive key once and verify password.
+  /// - Throws: PasswordError.incorrect
+  func unlock(password: String) throws -> Crypto.Unlocked {
+    return try crypto.unlock(password: password)
   }
 }
 
 extension IdentityKeystore {
   init(metadata: WalletMeta, mnemonic: Mnemonic, password: String) throws {
+    try self.init(metadata: metadata, mnemonic: mnemonic, seed: try MnemonicUtil.seed(from: mnemonic), password: password)
+  }
+
+  /// Init with the seed already computed from mnemonic.
+  init(metadata: WalletMeta, mnemonic: Mnemonic, seed seedData: Data, password: String) throws {
     version = IdentityKeystore.defaultVersion
     id = ETHKeystore.generateKeystoreId()
 
-    guard let btcMnemonic = BTCMnemonic(words: mnemonic.split(separator: " "), password: "", wordListType: .english),
-      let seedData = btcMnemonic.seed else {
-        throw MnemonicError.wordInvalid
-    }
+    let keys = try IdentityKeystore.deriveKeys(seed: seedData, isMainnet: metadata.isMainnet)
+    encKey = keys.encKey
+    identifier = keys.identifier
+    ipfsId = keys.ipfsId
+
+    crypto = Crypto(password: password, privateKey: keys.extendedPrivateKey, cacheDerivedKey: true)
+    let derivedKey = crypto.cachedDerivedKey(with: password)
 
-    guard let masterKeychain = BTCKeychain(seed: seedData) else {
+    let mnemonicHex = mnemonic.tk_toHexString()
+    encMnemonic = EncryptedMessage.create(crypto: crypto, derivedKey: derivedKey, message: mnemonicHex)
+
+    encAuthKey = EncryptedMessage.create(crypto: crypto, derivedKey: derivedKey, message: keys.authKey)
+
+    crypto.clearDerivedKey()
+
+    meta = metadata
+    walletIds = []
+    wallets = []
+
+  }
+
+  /// Hex of the extended private key, encryption key, identifier, IPFS ID and hex of the authentication key.
+  private static func deriveKeys(seed: Data, isMainnet: Bool) throws -> (extendedPrivateKey: String, encKey: String, identifier: String, ipfsId: String, authKey: String) {
+    guard let masterKeychain = BTCKeychain(seed: seed) else {
         throw GenericError.unknownError
     }
 
-    let network = metadata.isMainnet ? BTCNetwork.mainnet() : BTCNetwork.testnet()
+    let network = isMainnet ? BTCNetwork.mainnet() : BTCNetwork.testnet()
     masterKeychain.network = network
 
     let masterKey = (masterKeychain.key.privateKey as Data).tk_toHexString()
@@ -62,7 +95,7 @@ extension IdentityKeystore {
     let backupKey = BTCEncryptedBackup.backupKey(for: network, masterKey: masterKey.tk_dataFromHexString())
     let authenticationKey = BTCEncryptedBackup.authenticationKey(withBackupKey: backupKey)!
 
-    encKey = Encryptor.Hash.hmacSHA256(key: backupKey!, data: "Encryption Key".data(using: .utf8)!).tk_toHexString()
+    let encKey = Encryptor.Hash.hmacSHA256(key: backupKey!, data: "Encryption Key".data(using: .utf8)!).tk_toHexString()
 
     var identifierData = Data()
     // this magic hex will start with 'im' after base58check
@@ -78,51 +111,42 @@ extension IdentityKeystore {
     let hash160 = BTCHash160((authenticationKey.publicKey) as Data) as Data
     identifierData.append(hash160)
 
-    identifier = BTCBase58CheckStringWithData(identifierData)!
+    let identifier = BTCBase58CheckStringWithData(identifierData)!
 
     let ipfsIDKey = BTCKey(privateKey: encKey.tk_dataFromHexString())!
 
-    ipfsId = SigUtil.calcIPFSIDFromKey(ipfsIDKey)
-
-    crypto = Crypto(password: password, privateKey: masterKeychain.extendedPrivateKey.tk_toHexString(), cacheDerivedKey: true)
-    let derivedKey = crypto.cachedDerivedKey(with: password)
-
-    let mnemonicHex = mnemonic.tk_toHexString()
-    encMnemonic = EncryptedMessage.create(crypto: crypto, derivedKey: derivedKey, message: mnemonicHex)
+    let ipfsId = SigUtil.calcIPFSIDFromKey(ipfsIDKey)
 
     let authKeyHex = (authenticationKey.privateKey! as Data).tk_toHexString()
-    encAuthKey = EncryptedMessage.create(crypto: crypto, derivedKey: derivedKey, message: authKeyHex)
-
-    crypto.clearDerivedKey()
-
-    meta = metadata
-    walletIds = []
-    wallets = []
-
+    return (masterKeychain.extendedPrivateKey.tk_toHexString(), encKey, identifier, ipfsId, authKeyHex)
   }
 }
 
 // MARK: - Parsing JSON
 public extension IdentityKeystore {
   init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  internal init(fields: KeystoreFields) throws {
     id = ETHKeystore.generateKeystoreId()
-    version = (json["version"] as? Int) ?? IdentityKeystore.defaultVersion
+    version = fields.int("version") ?? IdentityKeystore.defaultVersion
 
-    guard let cryptoJSON = json["crypto"] as? JSONObject else {
+    guard let cryptoFields = fields.object("crypto") else {
       throw KeystoreError.invalid
     }
-    crypto = try Crypto(json: cryptoJSON)
+    crypto = try Crypto(fields: cryptoFields)
 
     guard
-      let encMnemonicJSON = json["encMnemonic"] as? JSONObject,
-      let encMnemonic = EncryptedMessage(json: encMnemonicJSON),
-      let identifier = json["identifier"] as? String,
-      let ipfsId = json["ipfsId"] as? String,
-      let encAuthKeyJSON = json["encAuthKey"] as? JSONObject,
-      let encAuthKey = EncryptedMessage(json: encAuthKeyJSON),
-      let encKey = json["encKey"] as? String,
-      let walletIds = json["walletIds"] as? [String],
-      let metaJSON = json[WalletMeta.key] as? JSONObject
+      let encMnemonicFields = fields.object("encMnemonic"),
+      let encMnemonic = EncryptedMessage(fields: encMnemonicFields),
+      let identifier = fields.string("identifier"),
+      let ipfsId = fields.string("ipfsId"),
+      let encAuthKeyFields = fields.object("encAuthKey"),
+      let encAuthKey = EncryptedMessage(fields: encAuthKeyFields),
+      let encKey = fields.string("encKey"),
+      let walletIds = fields.strings("walletIds"),
+      let metaFields = fields.object(WalletMeta.key)
     else {
       throw KeystoreError.invalid
     }
@@ -133,7 +157,7 @@ public extension IdentityKeystore {
     self.encKey = encKey
     self.walletIds = walletIds
     self.wallets = []
-    self.meta = try WalletMeta(json: metaJSON)
+    self.meta = WalletMeta(fields: metaFields)
   }
 
   func toJSON() -> JSONObject {
@@ -147,6 +171,7 @@ public extension IdentityKeystore {
       "encAuthKey": encAuthKey.toJSON(),
       "crypto": crypto.toJSON(),
       "walletIds": walletIds,
+      "walletIndex": wallets.compactMap { $0.summary?.toJSON() },
       WalletMeta.key: meta.toJSON()
     ]
   }
@@ -157,8 +182,9 @@ public extension IdentityKeystore {
   }
 
   func serializeToMap() -> [String: Any] {
-    let walletsJSON: [[String: Any]] = wallets.map { wallet in
-      return wallet.keystore.serializeToMap()
+    // Wallets whose keystore can't be loaded are left out
+    let walletsJSON: [[String: Any]] = wallets.compactMap { wallet in
+      return try? wallet.serializeToMap()
     }
 
     return [
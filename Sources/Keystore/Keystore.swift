@@ -36,16 +36,19 @@ extension ExportableKeystore {
 protocol PrivateKeyCrypto {
   var crypto: Crypto { get }
   func decryptPrivateKey(_ password: String) -> String
+  func decryptPrivateKey(_ unlocked: Crypto.Unlocked) -> String
 }
 
 protocol WIFCrypto {
   var crypto: Crypto { get }
   func decryptWIF(_ password: String) -> String
+  func decryptWIF(_ unlocked: Crypto.Unlocked) -> String
 }
 
 protocol XPrvCrypto {
   var crypto: Crypto { get }
   func decryptXPrv(_ password: String) -> String
+  func decryptXPrv(_ unlocked: Crypto.Unlocked) -> String
 }
 
 protocol EncMnemonicKeystore {
@@ -53,6 +56,7 @@ protocol EncMnemonicKeystore {
   var crypto: Crypto { get }
   var mnemonicPath: String { get }
   func decryptMnemonic(_ password: String) -> String
+  func decryptMnemonic(_ unlocked: Crypto.Unlocked) -> String
 }
 
 public extension Keystore {
@@ -92,10 +96,28 @@ public extension Keystore {
   }
 }
 
+extension Keystore {
+  /// Derive key once and verify password, the result decrypts every secret of the keystore.
+  /// - Throws: PasswordError.incorrect
+  func unlock(password: String) throws -> Crypto.Unlocked {
+    return try crypto.unlock(password: password)
+  }
+}
+
 extension PrivateKeyCrypto {
   func decryptPrivateKey(_ password: String) -> String {
     return crypto.privateKey(password: password)
   }
+
+  func decryptPrivateKey(_ unlocked: Crypto.Unlocked) -> String {
+    return unlocked.privateKey()
+  }
+}
+
+extension WIFCrypto {
+  func decryptWIF(_ password: String) -> String {
+    return decryptWIF(crypto.unverifiedUnlock(password: password))
+  }
 }
 
 extension EncMnemonicKeystore {
@@ -103,10 +125,18 @@ extension EncMnemonicKeystore {
     let mnemonicHexStr = encMnemonic.decrypt(crypto: crypto, password: password)
     return mnemonicHexStr.tk_fromHexString()
   }
+
+  func decryptMnemonic(_ unlocked: Crypto.Unlocked) -> String {
+    return encMnemonic.decrypt(with: unlocked).tk_fromHexString()
+  }
 }
 
 extension XPrvCrypto {
   func decryptXPrv(_ password: String) -> String {
     return crypto.privateKey(password: password).tk_fromHexString()
   }
+
+  func decryptXPrv(_ unlocked: Crypto.Unlocked) -> String {
+    return unlocked.privateKey().tk_fromHexString()
+  }
 }
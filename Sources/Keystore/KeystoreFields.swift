@@ -0,0 +1,62 @@
+//
+//  KeystoreFields.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Fields of a keystore object, either parsed JSON or binary storage content read in place (see BinaryKeystore).
+/// Keystore types read themselves from fields, so storages decode straight into them.
+/// A value of another type than asked for reads as nil, as `as?` casts on JSON do.
+enum KeystoreFields {
+  case json(JSONObject)
+  case binary(BinaryKeystore.Object)
+
+  func string(_ key: String) -> String? {
+    switch self {
+    case .json(let json):
+      return json[key] as? String
+    case .binary(let object):
+      return object.string(key)
+    }
+  }
+
+  func int(_ key: String) -> Int? {
+    switch self {
+    case .json(let json):
+      return json[key] as? Int
+    case .binary(let object):
+      return object.int(key)
+    }
+  }
+
+  func strings(_ key: String) -> [String]? {
+    switch self {
+    case .json(let json):
+      return json[key] as? [String]
+    case .binary(let object):
+      return object.strings(key)
+    }
+  }
+
+  func object(_ key: String) -> KeystoreFields? {
+    switch self {
+    case .json(let json):
+      return (json[key] as? JSONObject).map { .json($0) }
+    case .binary(let object):
+      return object.object(key).map { .binary($0) }
+    }
+  }
+
+  func objects(_ key: String) -> [KeystoreFields]? {
+    switch self {
+    case .json(let json):
+      return (json[key] as? [JSONObject])?.map { .json($0) }
+    case .binary(let object):
+      return object.objects(key)?.map { .binary($0) }
+    }
+  }
+}
@@ -0,0 +1,108 @@
+//
+//  UnlockSessionCache.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Opt-in cache of KDF derived keys by wallet ID.
+/// Once a wallet is unlocked with the correct password, calls with the same password within `ttl` seconds
+/// reuse its derived key, so a burst of signatures costs one KDF run.
+/// Derived keys are kept in locked memory and wiped when they expire or are removed.
+public struct UnlockSessionCache {
+  public static var isEnabled = false {
+    didSet {
+      if !isEnabled {
+        lockAll()
+      }
+    }
+  }
+  public static var ttl: TimeInterval = 300
+
+  private struct Entry {
+    let mac: String // Identifies the encryption, a re-encrypted keystore with the same ID never matches
+    let passwordDigest: Data
+    let derivedKey: SecureBytes
+    let expireAt: Date
+  }
+
+  private static var entries = [WalletID: Entry]()
+  private static let entriesLock = NSLock()
+  private static let passwordDigestKey = Data.tk_random(of: 32)
+
+  /// Derived key of the password for the crypto.
+  /// Served from the session when cached, otherwise runs KDF and caches the result if the password matches MAC.
+  static func derivedKey(walletID: WalletID, crypto: Crypto, password: String) -> String {
+    let digest = passwordDigest(password)
+
+    entriesLock.lock()
+    if let entry = entries[walletID] {
+      if entry.mac == crypto.mac && entry.passwordDigest == digest && entry.expireAt > Date() {
+        let bytes = entry.derivedKey.bytes
+        entriesLock.unlock()
+        return Hex.hex(from: bytes)
+      }
+      entries.removeValue(forKey: walletID)
+    }
+    entriesLock.unlock()
+
+    let derivedKey = crypto.kdfparams.derivedKey(for: password)
+    guard crypto.macForDerivedKey(key: derivedKey).lowercased() == crypto.mac.lowercased() else {
+      return derivedKey
+    }
+
+    let entry = Entry(mac: crypto.mac, passwordDigest: digest, derivedKey: SecureBytes(Hex.toBytes(derivedKey)), expireAt: Date(timeIntervalSinceNow: ttl))
+    entriesLock.lock()
+    entries[walletID] = entry
+    entriesLock.unlock()
+    scheduleEviction(after: ttl)
+
+    return derivedKey
+  }
+
+  /// Remove the derived key of the wallet.
+  public static func lock(walletID: WalletID) {
+    entriesLock.lock()
+    entries.removeValue(forKey: walletID)?.derivedKey.wipe()
+    entriesLock.unlock()
+  }
+
+  /// Remove all derived keys.
+  public static func lockAll() {
+    entriesLock.lock()
+    entries.values.forEach { $0.derivedKey.wipe() }
+    entries.removeAll()
+    entriesLock.unlock()
+  }
+
+  static func isUnlocked(walletID: WalletID) -> Bool {
+    entriesLock.lock()
+    defer { entriesLock.unlock() }
+    return entries[walletID].map { $0.expireAt > Date() } ?? false
+  }
+}
+
+private extension UnlockSessionCache {
+  static func passwordDigest(_ password: String) -> Data {
+    return Encryptor.Hash.hmacSHA256(key: passwordDigestKey, data: password.data(using: .utf8)!)
+  }
+
+  static func scheduleEviction(after interval: TimeInterval) {
+    DispatchQueue.global(qos: .utility).asyncAfter(deadline: .now() + interval) {
+      evictExpired()
+    }
+  }
+
+  static func evictExpired() {
+    let now = Date()
+    entriesLock.lock()
+    for (walletID, entry) in entries where entry.expireAt <= now {
+      entry.derivedKey.wipe()
+      entries.removeValue(forKey: walletID)
+    }
+    entriesLock.unlock()
+  }
+}
@@ -86,51 +86,55 @@ public struct WalletMeta {
   }
 
   public init(json: JSONObject) throws {
-    if let source = Source(rawValue: (json["source"] as? String) ?? "") {
+    self.init(fields: .json(json))
+  }
+
+  init(fields: KeystoreFields) {
+    if let source = Source(rawValue: fields.string("source") ?? "") {
       self.source = source
     } else {
       self.source = .newIdentity
     }
 
-    if let timestampString = json["timestamp"] as? String, let timestamp = Double(timestampString) {
+    if let timestampString = fields.string("timestamp"), let timestamp = Double(timestampString) {
       self.timestamp = timestamp
     } else {
       timestamp = WalletMeta.currentTime
     }
 
-    if let version = json["version"] as? String {
+    if let version = fields.string("version") {
       self.version = version
     } else {
       version = WalletMeta.currentVersion
     }
 
-    if let chainStr = json["chain"] as? String,
+    if let chainStr = fields.string("chain"),
       let chain = ChainType(rawValue: chainStr) {
       self.chain = chain
     }
 
-    if let networkStr = json["network"] as? String,
+    if let networkStr = fields.string("network"),
       let network = Network(rawValue: networkStr) {
       self.network = network
     }
 
-    if let mode = Mode(rawValue: (json["mode"] as? String) ?? "") {
+    if let mode = Mode(rawValue: fields.string("mode") ?? "") {
       self.mode = mode
     }
 
-    if let name = json["name"] as? String {
+    if let name = fields.string("name") {
       self.name = name
     }
 
-    if let passwordHint = json["passwordHint"] as? String {
+    if let passwordHint = fields.string("passwordHint") {
       self.passwordHint = passwordHint
     }
 
-    if let segWitStr = json["segWit"] as? String, let segWit = SegWit(rawValue: segWitStr) {
+    if let segWitStr = fields.string("segWit"), let segWit = SegWit(rawValue: segWitStr) {
       self.segWit = segWit
     }
 
-    if let backup = json["backup"] as? [String] {
+    if let backup = fields.strings("backup") {
       self.backup = backup
     }
   }
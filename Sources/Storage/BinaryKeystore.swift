@@ -0,0 +1,371 @@
+//
+//  BinaryKeystore.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Compact binary form of keystore JSON, used by storages to persist keystores.
+/// V3 JSON stays the import/export format, this only replaces what storages write and parse.
+///
+/// Layout: magic "TKB", format version, then the JSON tree as tagged values.
+/// Lengths, counts and (zigzag) integers are LEB128 varints. Lowercase hex strings (ciphertexts, salts, IVs, MACs, addresses)
+/// are kept as raw bytes, and read back as the same hex strings.
+///
+/// Content is read in place: one scan checks the whole tree and locates the keys of the top object,
+/// keystore types then read their fields straight from the bytes (see KeystoreFields), no JSON object is built.
+enum BinaryKeystore {
+  static let version: UInt8 = 1
+  private static let magic: [UInt8] = [0x54, 0x4b, 0x42] // "TKB"
+  private static let maxDepth = 16
+
+  private enum Tag: UInt8 {
+    case null = 0, boolFalse, boolTrue, int, double, string, hex, array, object
+  }
+
+  static func encode(_ json: JSONObject) -> [UInt8] {
+    var writer = Writer()
+    writer.bytes += magic
+    writer.bytes.append(version)
+    writer.write(json)
+    return writer.bytes
+  }
+
+  /// Top object of binary content, checked as a whole. Valid only as long as bytes are.
+  /// - Throws: KeystoreError.invalid if bytes are not a keystore of a known version
+  static func root(_ bytes: UnsafeBufferPointer<UInt8>) throws -> Object {
+    guard hasMagic(bytes) && bytes[magic.count] == version else {
+      throw KeystoreError.invalid
+    }
+    var reader = Reader(bytes: bytes, position: magic.count + 1)
+    guard let object = try reader.readObject(depth: 0), reader.position == bytes.count else {
+      throw KeystoreError.invalid
+    }
+    return object
+  }
+
+  static func isBinary(_ bytes: [UInt8]) -> Bool {
+    return bytes.withUnsafeBufferPointer { hasMagic($0) }
+  }
+
+  private static func hasMagic(_ bytes: UnsafeBufferPointer<UInt8>) -> Bool {
+    return bytes.count > magic.count && bytes.prefix(magic.count).elementsEqual(magic)
+  }
+
+  /// Read stored content, which is binary or, when written as JSON text, parsed JSON.
+  /// Fields are only valid while body runs.
+  /// - Returns: What body returns, nil if content is not a keystore or body throws.
+  static func withFields<T>(stored bytes: [UInt8], _ body: (KeystoreFields) throws -> T?) -> T? {
+    if isBinary(bytes) {
+      return bytes.withUnsafeBufferPointer { withFields(binary: $0, body) }
+    }
+    guard let json = try? String(decoding: bytes, as: UTF8.self).tk_toJSON() else {
+      return nil
+    }
+    return (try? body(.json(json))) ?? nil
+  }
+
+  /// Read binary content in caller memory, e.g. a memory mapped file, without copying it.
+  static func withFields<T>(binary bytes: UnsafeBufferPointer<UInt8>, _ body: (KeystoreFields) throws -> T?) -> T? {
+    guard let object = try? root(bytes) else {
+      return nil
+    }
+    return (try? body(.binary(object))) ?? nil
+  }
+}
+
+// MARK: - Object
+extension BinaryKeystore {
+  /// Object of binary content read in place. Its values were checked by the scan of the top object,
+  /// each is decoded only when asked for, as nil if it's missing or of another type.
+  struct Object {
+    fileprivate let bytes: UnsafeBufferPointer<UInt8>
+    /// Range of key bytes and position of value, of each field in stored order.
+    fileprivate let fields: [(key: Range<Int>, value: Int)]
+
+    /// String, or hex string stored as raw bytes.
+    func string(_ key: String) -> String? {
+      return read(key) { try $0.readString() }
+    }
+
+    func int(_ key: String) -> Int? {
+      return read(key) { try $0.readInt() }
+    }
+
+    func object(_ key: String) -> Object? {
+      return read(key) { try $0.readObject(depth: 0) }
+    }
+
+    /// Array whose elements are all objects.
+    func objects(_ key: String) -> [Object]? {
+      return read(key) { try $0.readArray { try $0.readObject(depth: 0) } }
+    }
+
+    /// Array whose elements are all strings.
+    func strings(_ key: String) -> [String]? {
+      return read(key) { try $0.readArray { try $0.readString() } }
+    }
+
+    private func read<T>(_ key: String, _ body: (inout Reader) throws -> T?) -> T? {
+      let key = key.utf8
+      guard let field = fields.first(where: { bytes[$0.key].elementsEqual(key) }) else {
+        return nil
+      }
+      var reader = Reader(bytes: bytes, position: field.value)
+      return (try? body(&reader)) ?? nil
+    }
+  }
+}
+
+// MARK: - Writer
+private extension BinaryKeystore {
+  static let hexDigits = Array("0123456789abcdef".utf8)
+
+  struct Writer {
+    var bytes = [UInt8]()
+
+    mutating func write(_ value: Any) {
+      switch value {
+      case let string as String:
+        if let raw = BinaryKeystore.bytes(ofHex: string) {
+          write(.hex)
+          writeBytes(raw)
+        } else {
+          write(.string)
+          writeBytes(Array(string.utf8))
+        }
+      case let number as NSNumber:
+        if CFGetTypeID(number) == CFBooleanGetTypeID() {
+          write(number.boolValue ? .boolTrue : .boolFalse)
+        } else if CFNumberIsFloatType(number) {
+          write(.double)
+          writeUInt64(number.doubleValue.bitPattern)
+        } else {
+          let value = number.int64Value
+          write(.int)
+          writeVarint(UInt64(bitPattern: value << 1 ^ value >> 63))
+        }
+      case let array as [Any]:
+        write(.array)
+        writeVarint(UInt64(array.count))
+        array.forEach { write($0) }
+      case let object as JSONObject:
+        write(.object)
+        writeVarint(UInt64(object.count))
+        for (key, value) in object {
+          writeBytes(Array(key.utf8))
+          write(value)
+        }
+      default:
+        write(.null)
+      }
+    }
+
+    mutating func write(_ tag: Tag) {
+      bytes.append(tag.rawValue)
+    }
+
+    mutating func writeBytes(_ value: [UInt8]) {
+      writeVarint(UInt64(value.count))
+      bytes += value
+    }
+
+    mutating func writeVarint(_ value: UInt64) {
+      var value = value
+      while value >= 0x80 {
+        bytes.append(UInt8(truncatingIfNeeded: value) | 0x80)
+        value >>= 7
+      }
+      bytes.append(UInt8(value))
+    }
+
+    mutating func writeUInt64(_ value: UInt64) {
+      for shift in stride(from: 56, through: 0, by: -8) {
+        bytes.append(UInt8(truncatingIfNeeded: value >> UInt64(shift)))
+      }
+    }
+  }
+
+  /// Bytes of a non-empty, even length, lowercase hex string. Anything else is kept as a string,
+  /// so decoding gives back exactly what was encoded.
+  static func bytes(ofHex string: String) -> [UInt8]? {
+    let utf8 = string.utf8
+    guard !utf8.isEmpty && utf8.count % 2 == 0 else {
+      return nil
+    }
+
+    var raw = [UInt8]()
+    raw.reserveCapacity(utf8.count / 2)
+    var high: UInt8?
+    for char in utf8 {
+      let nibble: UInt8
+      switch char {
+      case 0x30...0x39: nibble = char - 0x30
+      case 0x61...0x66: nibble = char - 0x61 + 10
+      default: return nil
+      }
+      if let value = high {
+        raw.append(value << 4 | nibble)
+        high = nil
+      } else {
+        high = nibble
+      }
+    }
+    return raw
+  }
+}
+
+// MARK: - Reader
+private extension BinaryKeystore {
+  struct Reader {
+    let bytes: UnsafeBufferPointer<UInt8>
+    var position: Int
+
+    /// Object at position, with the key of each field located and every value checked.
+    /// - Returns: nil if the value is of another type.
+    mutating func readObject(depth: Int) throws -> Object? {
+      guard try readTag() == .object else {
+        return nil
+      }
+      let count = try readCount()
+      var fields = [(key: Range<Int>, value: Int)]()
+      fields.reserveCapacity(count)
+      for _ in 0..<count {
+        let key = try readRange()
+        fields.append((key, position))
+        try skipValue(depth: depth + 1)
+      }
+      return Object(bytes: bytes, fields: fields)
+    }
+
+    mutating func readArray<T>(_ readElement: (inout Reader) throws -> T?) throws -> [T]? {
+      guard try readTag() == .array else {
+        return nil
+      }
+      let count = try readCount()
+      var array = [T]()
+      array.reserveCapacity(count)
+      for _ in 0..<count {
+        guard let element = try readElement(&self) else {
+          return nil
+        }
+        array.append(element)
+      }
+      return array
+    }
+
+    mutating func readString() throws -> String? {
+      switch try readTag() {
+      case .string:
+        return String(decoding: bytes[try readRange()], as: UTF8.self)
+      case .hex:
+        let raw = bytes[try readRange()]
+        var chars = [UInt8]()
+        chars.reserveCapacity(raw.count * 2)
+        for byte in raw {
+          chars.append(BinaryKeystore.hexDigits[Int(byte >> 4)])
+          chars.append(BinaryKeystore.hexDigits[Int(byte & 0x0f)])
+        }
+        return String(decoding: chars, as: UTF8.self)
+      default:
+        return nil
+      }
+    }
+
+    mutating func readInt() throws -> Int? {
+      guard try readTag() == .int else {
+        return nil
+      }
+      let zigzag = try readVarint()
+      return Int(Int64(bitPattern: zigzag >> 1 ^ (0 &- (zigzag & 1))))
+    }
+
+    /// Skip the value at position, throwing if it or anything it holds is malformed.
+    mutating func skipValue(depth: Int) throws {
+      guard depth <= BinaryKeystore.maxDepth else {
+        throw KeystoreError.invalid
+      }
+
+      switch try readTag() {
+      case .null, .boolFalse, .boolTrue:
+        break
+      case .int:
+        _ = try readVarint()
+      case .double:
+        _ = try readUInt64()
+      case .string, .hex:
+        _ = try readRange()
+      case .array:
+        for _ in 0..<(try readCount()) {
+          try skipValue(depth: depth + 1)
+        }
+      case .object:
+        for _ in 0..<(try readCount()) {
+          _ = try readRange()
+          try skipValue(depth: depth + 1)
+        }
+      }
+    }
+
+    mutating func readTag() throws -> Tag {
+      guard let tag = Tag(rawValue: try readByte()) else {
+        throw KeystoreError.invalid
+      }
+      return tag
+    }
+
+    mutating func readByte() throws -> UInt8 {
+      guard position < bytes.count else {
+        throw KeystoreError.invalid
+      }
+      position += 1
+      return bytes[position - 1]
+    }
+
+    mutating func readVarint() throws -> UInt64 {
+      var value: UInt64 = 0
+      var shift: UInt64 = 0
+      while true {
+        let byte = try readByte()
+        guard shift < 64 else {
+          throw KeystoreError.invalid
+        }
+        value |= UInt64(byte & 0x7f) << shift
+        if byte < 0x80 {
+          return value
+        }
+        shift += 7
+      }
+    }
+
+    /// Element count, each element takes at least one byte so it can't exceed what's left.
+    mutating func readCount() throws -> Int {
+      let count = try readVarint()
+      guard count <= UInt64(bytes.count - position) else {
+        throw KeystoreError.invalid
+      }
+      return Int(count)
+    }
+
+    /// Range of a length prefixed byte string.
+    mutating func readRange() throws -> Range<Int> {
+      let count = try readCount()
+      position += count
+      return (position - count)..<position
+    }
+
+    mutating func readUInt64() throws -> UInt64 {
+      guard position + 8 <= bytes.count else {
+        throw KeystoreError.invalid
+      }
+      var value: UInt64 = 0
+      for _ in 0..<8 {
+        value = value << 8 | UInt64(try readByte())
+      }
+      return value
+    }
+  }
+}
@@ -12,26 +12,22 @@ import Foundation
 /// - Note: In Memory Storage doesn't persist keystores thus
 ///             should not be used in production.
 ///             Expect to use it only for test purpose.
+///       Keystores are kept in binary form (see BinaryKeystore), nothing outlives the process for other versions to read.
 public final class InMemoryStorage: Storage {
   public init() {}
 
   public func tryLoadIdentity() -> Identity? {
-    guard
-      let content = InMemoryStorage.db["identity.json"],
-      let json = try? content.tk_toJSON(),
-      let identity = Identity(json: json)
-    else {
+    guard let content = InMemoryStorage.read("identity.json") else {
       return nil
     }
-    return identity
+    return BinaryKeystore.withFields(stored: content) { Identity(fields: $0) }
   }
 
   public func loadWalletByIDs(_ walletIDs: [String]) -> [BasicWallet] {
     var wallets = [BasicWallet]()
     walletIDs.forEach { walletID in
-      if let content = InMemoryStorage.db[walletID],
-        let json = try? content.tk_toJSON(),
-        let wallet = try? BasicWallet(json: json) {
+      if let content = InMemoryStorage.read(walletID),
+        let wallet = BinaryKeystore.withFields(stored: content, { try BasicWallet(fields: $0) }) {
         wallets.append(wallet)
       }
     }
@@ -39,26 +35,39 @@ public final class InMemoryStorage: Storage {
   }
 
   public func deleteWalletByID(_ walletID: String) -> Bool {
-    return InMemoryStorage.db.removeValue(forKey: walletID) != nil
+    return InMemoryStorage.update { $0.removeValue(forKey: walletID) != nil }
   }
 
   public func cleanStorage() -> Bool {
-    InMemoryStorage.db.removeAll()
+    InMemoryStorage.update { $0.removeAll() }
     return true
   }
 
   public func flushIdentity(_ keystore: IdentityKeystore) -> Bool {
-    let content = keystore.dump()
-    InMemoryStorage.db["identity.json"] = content
+    let content = BinaryKeystore.encode(keystore.toJSON())
+    InMemoryStorage.update { $0["identity.json"] = content }
     return true
   }
 
   public func flushWallet(_ keystore: Keystore) -> Bool {
-    let content = keystore.dump()
-    InMemoryStorage.db[keystore.id] = content
+    let content = BinaryKeystore.encode(keystore.toJSON())
+    InMemoryStorage.update { $0[keystore.id] = content }
     return true
   }
 
-  private static var db = [String: String]()
+  private static var db = [String: [UInt8]]()
+  private static let dbLock = NSLock()
   static var enabled = true
+
+  private static func read(_ key: String) -> [UInt8]? {
+    dbLock.lock()
+    defer { dbLock.unlock() }
+    return db[key]
+  }
+
+  private static func update<T>(_ body: (inout [String: [UInt8]]) -> T) -> T {
+    dbLock.lock()
+    defer { dbLock.unlock() }
+    return body(&db)
+  }
 }
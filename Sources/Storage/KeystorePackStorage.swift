@@ -0,0 +1,217 @@
+//
+//  KeystorePackStorage.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Read-only storage serving a fixed set of keystores from one packed file, e.g. bundled with a deployment.
+/// The file is memory mapped and searched through indexes sorted by wallet ID and by address,
+/// keystores are decoded in place only when asked for, so opening a pack costs the same whatever it holds.
+/// Packs are built with `write(identity:keystores:to:)`, every write method of the storage fails.
+public final class KeystorePackStorage: Storage {
+  static let version: UInt8 = 1
+
+  private enum SortedIndex: Int {
+    case walletID = 0, address
+  }
+
+  private static let magic: [UInt8] = [0x54, 0x4b, 0x50] // "TKP"
+  private static let headerSize = 16 // Magic, version, wallet count, identity offset and length
+  private static let entrySize = 16 // Key offset and length, keystore offset and length
+
+  private var base: UnsafeRawPointer?
+  private var size = 0
+  private var walletCount = 0
+
+  public convenience init() {
+    self.init(url: URL(fileURLWithPath: "\(NSHomeDirectory())/Documents/wallets/keystores.pack"))
+  }
+
+  /// Serve the pack at url, e.g. one shipped to a fleet of devices. A missing or invalid pack serves nothing.
+  public init(url: URL) {
+    map(url.path)
+  }
+
+  deinit {
+    if let base = base {
+      munmap(UnsafeMutableRawPointer(mutating: base), size)
+    }
+  }
+
+  public func tryLoadIdentity() -> Identity? {
+    return withKeystore(at: 8) { Identity(fields: $0) }
+  }
+
+  public func loadWalletByIDs(_ walletIDs: [String]) -> [BasicWallet] {
+    return walletIDs.compactMap { walletID in
+      guard let entry = find(walletID, in: .walletID) else {
+        return nil
+      }
+      return withKeystore(at: entry) { try BasicWallet(fields: $0) }
+    }
+  }
+
+  public func loadWallet(address: String, on chainType: ChainType) -> BasicWallet? {
+    guard let entry = find(KeystorePackStorage.addressKey(address, on: chainType), in: .address) else {
+      return nil
+    }
+    return withKeystore(at: entry) { try BasicWallet(fields: $0) }
+  }
+
+  public func deleteWalletByID(_ walletID: String) -> Bool {
+    return false
+  }
+
+  public func cleanStorage() -> Bool {
+    return false
+  }
+
+  public func flushIdentity(_ keystore: IdentityKeystore) -> Bool {
+    return false
+  }
+
+  public func flushWallet(_ keystore: Keystore) -> Bool {
+    return false
+  }
+}
+
+// MARK: - Building packs
+public extension KeystorePackStorage {
+  /// Pack identity, if any, and wallet keystores into a file this storage serves.
+  /// - Throws: GenericError.storeWalletFailed if the pack outgrows its 32-bit offsets, or the error writing the file.
+  static func write(identity: IdentityKeystore?, keystores: [Keystore], to url: URL) throws {
+    let tablesSize = 2 * keystores.count * entrySize
+    let dataStart = headerSize + tablesSize
+    var area = [UInt8]()
+    func place(_ bytes: [UInt8]) -> (offset: Int, count: Int) {
+      defer { area += bytes }
+      return (dataStart + area.count, bytes.count)
+    }
+
+    let identityRegion = place(identity.map { BinaryKeystore.encode($0.toJSON()) } ?? [])
+    let keystoreRegions = keystores.map { place(BinaryKeystore.encode($0.toJSON())) }
+    let idKeys = keystores.map { Array($0.id.utf8) }
+    let addressKeys = keystores.map { keystore -> [UInt8] in
+      guard let chainType = keystore.meta.chain else {
+        return []
+      }
+      return Array(addressKey(keystore.address, on: chainType).utf8)
+    }
+
+    var pack = magic
+    pack.append(version)
+    appendUInt32(keystores.count, to: &pack)
+    appendUInt32(identityRegion.offset, to: &pack)
+    appendUInt32(identityRegion.count, to: &pack)
+    for keys in [idKeys, addressKeys] {
+      let keyRegions = keys.map { place($0) }
+      let sorted = keys.indices.sorted { keys[$0].lexicographicallyPrecedes(keys[$1]) }
+      for i in sorted {
+        appendUInt32(keyRegions[i].offset, to: &pack)
+        appendUInt32(keyRegions[i].count, to: &pack)
+        appendUInt32(keystoreRegions[i].offset, to: &pack)
+        appendUInt32(keystoreRegions[i].count, to: &pack)
+      }
+    }
+    pack += area
+
+    guard pack.count <= Int(UInt32.max) else {
+      throw GenericError.storeWalletFailed
+    }
+    try Data(bytes: pack).write(to: url, options: .atomic)
+  }
+}
+
+// MARK: - Reading
+private extension KeystorePackStorage {
+  static func addressKey(_ address: String, on chainType: ChainType) -> String {
+    return "\(chainType.rawValue):\(chainType.normalizedAddress(address))"
+  }
+
+  static func appendUInt32(_ value: Int, to bytes: inout [UInt8]) {
+    let value = UInt32(truncatingIfNeeded: value)
+    bytes += [UInt8(truncatingIfNeeded: value >> 24), UInt8(truncatingIfNeeded: value >> 16), UInt8(truncatingIfNeeded: value >> 8), UInt8(truncatingIfNeeded: value)]
+  }
+
+  /// Map the pack and check its header and indexes fit, otherwise the storage stays empty.
+  func map(_ path: String) {
+    let descriptor = open(path, O_RDONLY)
+    guard descriptor >= 0 else {
+      return
+    }
+    defer { close(descriptor) }
+
+    var status = stat()
+    guard fstat(descriptor, &status) == 0 && Int(status.st_size) >= KeystorePackStorage.headerSize,
+      let mapped = mmap(nil, Int(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0),
+      mapped != UnsafeMutableRawPointer(bitPattern: -1)
+    else {
+      return
+    }
+    base = UnsafeRawPointer(mapped)
+    size = Int(status.st_size)
+
+    let count = readUInt32(at: 4)
+    guard let header = bytes(at: 0, count: 4), header.prefix(3).elementsEqual(KeystorePackStorage.magic),
+      header[3] == KeystorePackStorage.version,
+      KeystorePackStorage.headerSize + 2 * count * KeystorePackStorage.entrySize <= size
+    else {
+      munmap(mapped, size)
+      base = nil
+      size = 0
+      return
+    }
+    walletCount = count
+  }
+
+  func bytes(at offset: Int, count: Int) -> UnsafeBufferPointer<UInt8>? {
+    guard let base = base, offset >= 0 && count >= 0 && offset + count <= size else {
+      return nil
+    }
+    return UnsafeBufferPointer(start: base.assumingMemoryBound(to: UInt8.self) + offset, count: count)
+  }
+
+  func readUInt32(at offset: Int) -> Int {
+    guard let field = bytes(at: offset, count: 4) else {
+      return 0
+    }
+    return Int(field[0]) << 24 | Int(field[1]) << 16 | Int(field[2]) << 8 | Int(field[3])
+  }
+
+  /// Read the keystore whose offset and length are stored at the position, in place.
+  func withKeystore<T>(at position: Int, _ body: (KeystoreFields) throws -> T?) -> T? {
+    guard let region = bytes(at: readUInt32(at: position), count: readUInt32(at: position + 4)) else {
+      return nil
+    }
+    return BinaryKeystore.withFields(binary: region, body)
+  }
+
+  /// Binary search the sorted index for the key.
+  /// - Returns: Position of the keystore offset and length of the entry found.
+  func find(_ key: String, in index: SortedIndex) -> Int? {
+    let key = Array(key.utf8)
+    let tableStart = KeystorePackStorage.headerSize + index.rawValue * walletCount * KeystorePackStorage.entrySize
+    var low = 0
+    var high = walletCount
+    while low < high {
+      let mid = (low + high) / 2
+      let entry = tableStart + mid * KeystorePackStorage.entrySize
+      guard let entryKey = bytes(at: readUInt32(at: entry), count: readUInt32(at: entry + 4)) else {
+        return nil
+      }
+
+      if entryKey.lexicographicallyPrecedes(key) {
+        low = mid + 1
+      } else if key.lexicographicallyPrecedes(entryKey) {
+        high = mid
+      } else {
+        return entry + 8
+      }
+    }
+    return nil
+  }
+}
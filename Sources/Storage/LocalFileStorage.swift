@@ -8,16 +8,18 @@
 
 import Foundation
 
+/// Storage keeping each keystore in its own file as JSON text, the format every version of the library reads,
+/// so downgrading keeps the wallets. Binary files (see BinaryKeystore) are read too.
 public final class LocalFileStorage: Storage {
   private let identityFileName = "identity.json"
   public init() {}
 
   public func tryLoadIdentity() -> Identity? {
-    guard let jsonObject = tryLoadJSON(identityFileName) else {
+    guard let fileContent = readFrom(identityFileName) else {
       return nil
     }
 
-    return Identity(json: jsonObject)
+    return BinaryKeystore.withFields(stored: fileContent) { Identity(fields: $0) }
   }
 
   public func loadWalletByIDs(_ walletIDs: [String]) -> [BasicWallet] {
@@ -27,12 +29,11 @@ public final class LocalFileStorage: Storage {
       guard let id = try? WalletIDValidator(walletID: walletID).validate() else {
         continue
       }
-      let json = tryLoadJSON(id)
-      if json == nil {
+      guard let fileContent = readFrom(id) else {
         continue
       }
 
-      if let wallet = try? BasicWallet(json: json!) {
+      if let wallet = BinaryKeystore.withFields(stored: fileContent, { try BasicWallet(fields: $0) }) {
         wallets.append(wallet)
       }
     }
@@ -58,13 +59,13 @@ public final class LocalFileStorage: Storage {
   }
 
   public func flushIdentity(_ keystore: IdentityKeystore) -> Bool {
-    return writeContent(keystore.dump(), to: identityFileName)
+    return writeContent(Array(keystore.dump().utf8), to: identityFileName)
   }
 
   public func flushWallet(_ keystore: Keystore) -> Bool {
     do {
       let id = try WalletIDValidator(walletID: keystore.id).validate()
-      return writeContent(keystore.dump(), to: id)
+      return writeContent(Array(keystore.dump().utf8), to: id)
     } catch {
       return false
     }
@@ -72,28 +73,18 @@ public final class LocalFileStorage: Storage {
 }
 
 private extension LocalFileStorage {
- func tryLoadJSON(_ filename: String) -> JSONObject? {
-    do {
-      guard let fileContent = readFrom(filename) else {
-        return nil
-      }
-      return try? fileContent.tk_toJSON()
-    }
-  }
-
-  func readFrom(_ filename: String) -> String? {
-    do {
-      let filePath = walletsDirectory.appendingPathComponent(filename).path
-      return try String(contentsOfFile: filePath, encoding: .utf8)
-    } catch {
+  func readFrom(_ filename: String) -> [UInt8]? {
+    let filePath = walletsDirectory.appendingPathComponent(filename).path
+    guard let data = FileManager.default.contents(atPath: filePath) else {
       return nil
     }
+    return [UInt8](data)
   }
 
-  func writeContent(_ content: String, to filename: String) -> Bool {
+  func writeContent(_ content: [UInt8], to filename: String) -> Bool {
     do {
-      let filePath = walletsDirectory.appendingPathComponent(filename).path
-      try content.write(toFile: filePath, atomically: true, encoding: .utf8)
+      let fileURL = walletsDirectory.appendingPathComponent(filename)
+      try Data(bytes: content).write(to: fileURL, options: .atomic)
       return true
     } catch {
       debugPrint("Error: \(error)")
@@ -0,0 +1,508 @@
+//
+//  LogFileStorage.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+import CryptoSwift
+
+/// Storage keeping all keystores, in binary form (see BinaryKeystore), in one append-only log.
+/// Each commit appends one checksummed record holding a batch of changes and syncs it before returning,
+/// so a wallet and the identity listing it are written together or not at all.
+/// On load the log is replayed up to the first torn or corrupt record, which is cut off.
+/// A checksummed record this build can't read, e.g. from a newer format, stops the replay instead and opens the log read-only.
+/// Committing a wallet logs only its entry of the identity wallet index, the identity itself is written in full
+/// by flushIdentity and by compaction, so each import or delete appends O(1) bytes however many wallets there are.
+/// Once the log grows mostly stale it's compacted into a snapshot of current keystores.
+public final class LogFileStorage: Storage {
+  /// Compact when the log is both larger than compactionMinSize and compactionRatio times its live content.
+  static var compactionMinSize = 1 << 20
+  static var compactionRatio = 2
+
+  private enum Change {
+    case put(key: String, content: [UInt8])
+    case delete(key: String)
+    /// Add or update an entry of the identity wallet index, content is the binary WalletSummary.
+    case putIndex(walletID: String, summary: [UInt8])
+    case deleteIndex(walletID: String)
+  }
+
+  /// Wallet index of the stored identity in wallet order, summaries kept in their stored form.
+  private struct WalletIndex {
+    var walletIDs = [String]()
+    var summaries = [String: [UInt8]]()
+
+    /// - Returns: Summary replaced, if walletID was already listed.
+    mutating func put(_ walletID: String, summary: [UInt8]) -> [UInt8]? {
+      guard let old = summaries.updateValue(summary, forKey: walletID) else {
+        walletIDs.append(walletID)
+        return nil
+      }
+      return old
+    }
+
+    mutating func remove(_ walletID: String) -> [UInt8]? {
+      guard let old = summaries.removeValue(forKey: walletID) else {
+        return nil
+      }
+      walletIDs.remove(at: walletIDs.index(of: walletID)!)
+      return old
+    }
+
+    /// Summaries in wallet order, those that can't be decoded left out.
+    func decodedSummaries() -> [WalletSummary] {
+      return walletIDs.compactMap { walletID in
+        LogFileStorage.withFields(summaries[walletID]!) { WalletSummary(fields: $0) }
+      }
+    }
+  }
+
+  private struct Record {
+    let changes: [Change]
+    let end: Int
+  }
+
+  private enum DecodedRecord {
+    case record(Record)
+    /// Length or checksum doesn't hold, what an interrupted commit leaves.
+    case torn
+    /// Checksum holds but the payload isn't in a format this build knows.
+    case unknown
+  }
+
+  private static let putTag: UInt8 = 1
+  private static let deleteTag: UInt8 = 2
+  private static let putIndexTag: UInt8 = 3
+  private static let deleteIndexTag: UInt8 = 4
+  private static let headerSize = 8 // Payload length and CRC32 of payload, both big endian UInt32
+
+  private let identityKey = "identity.json"
+  private let directory: URL
+  private let logPath: String
+  private var db = [String: [UInt8]]()
+  /// Index of the identity last written in full, with index changes logged since applied.
+  /// Nil when that identity has no usable index, the next wallet commit then writes the identity in full.
+  private var walletIndex: WalletIndex?
+  /// Bytes index changes added to the identity since it was last written in full, part of liveSize.
+  private var walletIndexDelta = 0
+  private var liveSize = 0
+  private var logSize = 0
+  private var fileDescriptor: Int32 = -1
+  private let lock = NSLock()
+  /// Set when replay stops at a record it can't read, commits then fail rather than write records it would never replay.
+  private(set) var isReadOnly = false
+
+  public convenience init() {
+    self.init(directory: LogFileStorage.defaultDirectory)
+  }
+
+  init(directory: URL) {
+    self.directory = directory
+    logPath = directory.appendingPathComponent("keystores.log").path
+    replay()
+    if !isReadOnly {
+      openLog()
+    }
+  }
+
+  deinit {
+    closeLog()
+  }
+
+  /// Stored identity, with its wallet list and index replaced by the current wallet index.
+  public func tryLoadIdentity() -> Identity? {
+    lock.lock()
+    let content = db[identityKey]
+    let index = walletIndex
+    lock.unlock()
+    guard let identityContent = content else {
+      return nil
+    }
+    let summaries = index?.decodedSummaries()
+    return LogFileStorage.withFields(identityContent) { Identity(fields: $0, walletIDs: index?.walletIDs, walletIndex: summaries) }
+  }
+
+  public func loadWalletByIDs(_ walletIDs: [String]) -> [BasicWallet] {
+    return walletIDs.compactMap { walletID in
+      guard let content = read(walletID) else {
+        return nil
+      }
+      return LogFileStorage.withFields(content) { try BasicWallet(fields: $0) }
+    }
+  }
+
+  public func deleteWalletByID(_ walletID: String) -> Bool {
+    guard read(walletID) != nil else {
+      return false
+    }
+    return commit([.delete(key: walletID)])
+  }
+
+  public func cleanStorage() -> Bool {
+    lock.lock()
+    defer { lock.unlock() }
+
+    closeLog()
+    guard unlink(logPath) == 0 || errno == ENOENT else {
+      openLog()
+      return false
+    }
+    db.removeAll()
+    isReadOnly = false
+    walletIndex = nil
+    walletIndexDelta = 0
+    liveSize = 0
+    logSize = 0
+    openLog()
+    return true
+  }
+
+  public func flushIdentity(_ keystore: IdentityKeystore) -> Bool {
+    return commit([.put(key: identityKey, content: BinaryKeystore.encode(keystore.toJSON()))])
+  }
+
+  public func flushWallet(_ keystore: Keystore) -> Bool {
+    return commit([.put(key: keystore.id, content: BinaryKeystore.encode(keystore.toJSON()))])
+  }
+
+  public func flushWallet(_ keystore: Keystore, identity: IdentityKeystore) -> Bool {
+    let wallet = Change.put(key: keystore.id, content: BinaryKeystore.encode(keystore.toJSON()))
+    guard let summary = WalletSummary(keystore) else {
+      return commit([wallet, .put(key: identityKey, content: BinaryKeystore.encode(identity.toJSON()))])
+    }
+    return commit(wallet, indexChange: .putIndex(walletID: keystore.id, summary: BinaryKeystore.encode(summary.toJSON())), of: identity)
+  }
+
+  public func removeWallet(_ walletID: String, identity: IdentityKeystore) -> Bool {
+    return commit(.delete(key: walletID), indexChange: .deleteIndex(walletID: walletID), of: identity)
+  }
+}
+
+// MARK: - Log
+private extension LogFileStorage {
+  static var defaultDirectory: URL {
+    let walletsPath = "\(NSHomeDirectory())/Documents/wallets"
+    var walletsDirectory = URL(fileURLWithPath: walletsPath)
+
+    do {
+      if !FileManager.default.fileExists(atPath: walletsPath) {
+        try FileManager.default.createDirectory(atPath: walletsDirectory.path, withIntermediateDirectories: true, attributes: nil)
+        var resourceValues = URLResourceValues()
+        resourceValues.isExcludedFromBackup = true
+        try walletsDirectory.setResourceValues(resourceValues)
+      }
+    } catch let err {
+      debugPrint(err)
+    }
+
+    return walletsDirectory
+  }
+
+  func read(_ key: String) -> [UInt8]? {
+    lock.lock()
+    defer { lock.unlock() }
+    return db[key]
+  }
+
+  func commit(_ changes: [Change]) -> Bool {
+    lock.lock()
+    defer { lock.unlock() }
+    return commitLocked(changes)
+  }
+
+  /// Commit a wallet change with its change to the identity wallet index,
+  /// or with the whole identity if the stored one has no index to change.
+  func commit(_ change: Change, indexChange: Change, of identity: IdentityKeystore) -> Bool {
+    lock.lock()
+    defer { lock.unlock() }
+    if walletIndex == nil {
+      return commitLocked([change, .put(key: identityKey, content: BinaryKeystore.encode(identity.toJSON()))])
+    }
+    return commitLocked([change, indexChange])
+  }
+
+  func commitLocked(_ changes: [Change]) -> Bool {
+    let record = LogFileStorage.encode(changes)
+    guard append(record) else {
+      return false
+    }
+    logSize += record.count
+    changes.forEach { apply($0) }
+
+    if logSize >= LogFileStorage.compactionMinSize && logSize > liveSize * LogFileStorage.compactionRatio {
+      compact()
+    }
+    return true
+  }
+
+  func apply(_ change: Change) {
+    switch change {
+    case .put(let key, let content):
+      if let old = db.updateValue(content, forKey: key) {
+        liveSize -= LogFileStorage.size(key: key, content: old)
+      }
+      liveSize += LogFileStorage.size(key: key, content: content)
+      if key == identityKey {
+        walletIndex = LogFileStorage.walletIndex(ofStoredIdentity: content)
+        liveSize -= walletIndexDelta
+        walletIndexDelta = 0
+      }
+    case .delete(let key):
+      if let old = db.removeValue(forKey: key) {
+        liveSize -= LogFileStorage.size(key: key, content: old)
+      }
+      if key == identityKey {
+        walletIndex = nil
+        liveSize -= walletIndexDelta
+        walletIndexDelta = 0
+      }
+    case .putIndex(let walletID, let summary):
+      var delta = LogFileStorage.size(key: walletID, content: summary)
+      if let old = walletIndex?.put(walletID, summary: summary) {
+        delta -= LogFileStorage.size(key: walletID, content: old)
+      }
+      walletIndexDelta += delta
+      liveSize += delta
+    case .deleteIndex(let walletID):
+      if let old = walletIndex?.remove(walletID) {
+        let delta = LogFileStorage.size(key: walletID, content: old)
+        walletIndexDelta -= delta
+        liveSize -= delta
+      }
+    }
+  }
+
+  /// Stored identity with its wallet list and index replaced by the given index, to write in full.
+  func identityContent(with index: WalletIndex) -> [UInt8]? {
+    guard let content = db[identityKey],
+      var keystore = LogFileStorage.withFields(content, { try IdentityKeystore(fields: $0) })
+    else {
+      return nil
+    }
+    keystore.walletIds = index.walletIDs
+    var json = keystore.toJSON()
+    json["walletIndex"] = index.decodedSummaries().map { $0.toJSON() }
+    return BinaryKeystore.encode(json)
+  }
+
+  func replay() {
+    guard let data = FileManager.default.contents(atPath: logPath) else {
+      return
+    }
+
+    let bytes = [UInt8](data)
+    var offset = 0
+    replaying: while offset < bytes.count {
+      switch LogFileStorage.decodeRecord(bytes, at: offset) {
+      case .record(let record):
+        record.changes.forEach { apply($0) }
+        offset = record.end
+      case .torn:
+        // Torn or corrupt tail left by an interrupted commit
+        _ = truncate(logPath, off_t(offset))
+        break replaying
+      case .unknown:
+        // Keep the record and everything after it for the build that wrote them
+        isReadOnly = true
+        break replaying
+      }
+    }
+    logSize = offset
+  }
+
+  func openLog() {
+    fileDescriptor = open(logPath, O_WRONLY | O_APPEND | O_CREAT, 0o600)
+  }
+
+  func closeLog() {
+    if fileDescriptor >= 0 {
+      close(fileDescriptor)
+      fileDescriptor = -1
+    }
+  }
+
+  func append(_ record: [UInt8]) -> Bool {
+    guard fileDescriptor >= 0 else {
+      return false
+    }
+
+    let written = record.withUnsafeBufferPointer { write(fileDescriptor, $0.baseAddress, $0.count) }
+    guard written == record.count && fsync(fileDescriptor) == 0 else {
+      // Cut off a partial record so later commits stay readable
+      _ = ftruncate(fileDescriptor, off_t(logSize))
+      return false
+    }
+    return true
+  }
+
+  /// Write current keystores into a new log as one record, then swap it in.
+  /// Index changes are folded into the identity, so the snapshot holds it in full.
+  func compact() {
+    if let index = walletIndex, let identity = identityContent(with: index) {
+      apply(.put(key: identityKey, content: identity))
+    }
+    let snapshot = LogFileStorage.encode(db.map { Change.put(key: $0.key, content: $0.value) })
+    let snapshotPath = logPath + ".compacting"
+
+    let snapshotDescriptor = open(snapshotPath, O_WRONLY | O_CREAT | O_TRUNC, 0o600)
+    guard snapshotDescriptor >= 0 else {
+      return
+    }
+    let written = snapshot.withUnsafeBufferPointer { write(snapshotDescriptor, $0.baseAddress, $0.count) }
+    let isSynced = written == snapshot.count && fsync(snapshotDescriptor) == 0
+    close(snapshotDescriptor)
+
+    guard isSynced && rename(snapshotPath, logPath) == 0 else {
+      _ = unlink(snapshotPath)
+      return
+    }
+
+    // Persist the rename itself
+    let directoryDescriptor = open(directory.path, O_RDONLY)
+    if directoryDescriptor >= 0 {
+      _ = fsync(directoryDescriptor)
+      close(directoryDescriptor)
+    }
+
+    closeLog()
+    openLog()
+    logSize = snapshot.count
+  }
+}
+
+// MARK: - Record format
+// Record: payload length (UInt32), CRC32 of payload (UInt32), payload.
+// Payload: changes, each is tag (UInt8), key length (UInt32), key, content length (UInt32), content.
+// Index changes are keyed by wallet ID, deletes have empty content.
+// Content is a binary keystore.
+private extension LogFileStorage {
+  static func size(key: String, content: [UInt8]) -> Int {
+    return 9 + key.utf8.count + content.count
+  }
+
+  static func encode(_ changes: [Change]) -> [UInt8] {
+    var payload = [UInt8]()
+    for change in changes {
+      switch change {
+      case .put(let key, let content):
+        payload.append(putTag)
+        appendField(Array(key.utf8), to: &payload)
+        appendField(content, to: &payload)
+      case .delete(let key):
+        payload.append(deleteTag)
+        appendField(Array(key.utf8), to: &payload)
+        appendField([], to: &payload)
+      case .putIndex(let walletID, let summary):
+        payload.append(putIndexTag)
+        appendField(Array(walletID.utf8), to: &payload)
+        appendField(summary, to: &payload)
+      case .deleteIndex(let walletID):
+        payload.append(deleteIndexTag)
+        appendField(Array(walletID.utf8), to: &payload)
+        appendField([], to: &payload)
+      }
+    }
+
+    var record = [UInt8]()
+    record.reserveCapacity(headerSize + payload.count)
+    appendUInt32(UInt32(payload.count), to: &record)
+    appendUInt32(payload.crc32(), to: &record)
+    record += payload
+    return record
+  }
+
+  static func decodeRecord(_ bytes: [UInt8], at offset: Int) -> DecodedRecord {
+    guard offset + headerSize <= bytes.count else {
+      return .torn
+    }
+    let payloadStart = offset + headerSize
+    let end = payloadStart + Int(readUInt32(bytes, at: offset))
+    guard end <= bytes.count else {
+      return .torn
+    }
+    let payload = Array(bytes[payloadStart..<end])
+    guard payload.crc32() == readUInt32(bytes, at: offset + 4) else {
+      return .torn
+    }
+
+    var changes = [Change]()
+    var position = 0
+    while position < payload.count {
+      let tag = payload[position]
+      position += 1
+      guard
+        let keyField = readField(payload, at: &position),
+        let key = String(bytes: keyField, encoding: .utf8),
+        let content = readField(payload, at: &position)
+      else {
+        return .unknown
+      }
+      switch tag {
+      case putTag:
+        changes.append(.put(key: key, content: content))
+      case deleteTag:
+        changes.append(.delete(key: key))
+      case putIndexTag:
+        changes.append(.putIndex(walletID: key, summary: content))
+      case deleteIndexTag:
+        changes.append(.deleteIndex(walletID: key))
+      default:
+        return .unknown
+      }
+    }
+    return .record(Record(changes: changes, end: end))
+  }
+
+  /// Read binary content, the only form this log holds.
+  static func withFields<T>(_ content: [UInt8], _ body: (KeystoreFields) throws -> T?) -> T? {
+    return content.withUnsafeBufferPointer { BinaryKeystore.withFields(binary: $0, body) }
+  }
+
+  /// Index of an identity whose wallet index lists exactly its wallets, as Identity requires to use it.
+  static func walletIndex(ofStoredIdentity content: [UInt8]) -> WalletIndex? {
+    return withFields(content) { identity -> WalletIndex? in
+      guard
+        let walletIDs = identity.strings("walletIds"),
+        let summaries = identity.objects("walletIndex")?.compactMap({ WalletSummary(fields: $0) }),
+        summaries.map({ $0.walletID }) == walletIDs
+      else {
+        return nil
+      }
+
+      var index = WalletIndex()
+      for summary in summaries {
+        _ = index.put(summary.walletID, summary: BinaryKeystore.encode(summary.toJSON()))
+      }
+      return index
+    }
+  }
+
+  static func appendField(_ field: [UInt8], to bytes: inout [UInt8]) {
+    appendUInt32(UInt32(field.count), to: &bytes)
+    bytes += field
+  }
+
+  static func readField(_ bytes: [UInt8], at position: inout Int) -> [UInt8]? {
+    guard position + 4 <= bytes.count else {
+      return nil
+    }
+    let end = position + 4 + Int(readUInt32(bytes, at: position))
+    guard end <= bytes.count else {
+      return nil
+    }
+    let field = Array(bytes[(position + 4)..<end])
+    position = end
+    return field
+  }
+
+  static func appendUInt32(_ value: UInt32, to bytes: inout [UInt8]) {
+    bytes += [UInt8(truncatingIfNeeded: value >> 24), UInt8(truncatingIfNeeded: value >> 16), UInt8(truncatingIfNeeded: value >> 8), UInt8(truncatingIfNeeded: value)]
+  }
+
+  static func readUInt32(_ bytes: [UInt8], at offset: Int) -> UInt32 {
+    return UInt32(bytes[offset]) << 24 | UInt32(bytes[offset + 1]) << 16 | UInt32(bytes[offset + 2]) << 8 | UInt32(bytes[offset + 3])
+  }
+}
@@ -16,4 +16,18 @@ public protocol Storage {
   func cleanStorage() -> Bool
   func flushIdentity(_ keystore: IdentityKeystore) -> Bool
   func flushWallet(_ keystore: Keystore) -> Bool
+  /// Persist a wallet and the identity listing it, in one commit if the storage supports it.
+  func flushWallet(_ keystore: Keystore, identity: IdentityKeystore) -> Bool
+  /// Persist the identity no longer listing a wallet, dropping the wallet in the same commit if the storage supports it.
+  func removeWallet(_ walletID: String, identity: IdentityKeystore) -> Bool
+}
+
+public extension Storage {
+  func flushWallet(_ keystore: Keystore, identity: IdentityKeystore) -> Bool {
+    return flushWallet(keystore) && flushIdentity(identity)
+  }
+
+  func removeWallet(_ walletID: String, identity: IdentityKeystore) -> Bool {
+    return flushIdentity(identity)
+  }
 }
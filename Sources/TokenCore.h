@@ -11,3 +11,5 @@
 FOUNDATION_EXPORT double TokenCoreVersionNumber;
 
 FOUNDATION_EXPORT const unsigned char TokenCoreVersionString[];
+
+#import <TokenCore/TKHash.h>
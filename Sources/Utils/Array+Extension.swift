@@ -0,0 +1,40 @@
+//
+//  Array+Extension.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+extension Array {
+  /// Map elements on concurrent workers, results keep the order of elements.
+  /// Meant for a few heavy and independent jobs, e.g. running KDF for several keystores.
+  /// - Throws: The first error thrown by transform, after all workers finish.
+  func tk_concurrentMap<T>(_ transform: (Element) throws -> T) throws -> [T] {
+    var results = [T?](repeating: nil, count: count)
+    var firstError: Error?
+    let errorLock = NSLock()
+
+    results.withUnsafeMutableBufferPointer { buffer in
+      let output = buffer // Every worker writes its own slot only
+      DispatchQueue.concurrentPerform(iterations: count) { index in
+        do {
+          output[index] = try transform(self[index])
+        } catch {
+          errorLock.lock()
+          if firstError == nil {
+            firstError = error
+          }
+          errorLock.unlock()
+        }
+      }
+    }
+
+    if let error = firstError {
+      throw error
+    }
+    return results.map { $0! }
+  }
+}
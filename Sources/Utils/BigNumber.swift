@@ -9,26 +9,26 @@
 import Foundation
 import BigInt
 
-// Unsigned big number powoered by BigUInt
+// Unsigned big number, kept as minimal big endian bytes.
+// Values within 256 bits are parsed by UInt256, larger ones fall back to BigUInt.
 public struct BigNumber {
-    private let value: BigUInt
+    private let bytes: [UInt8]
     private let padding: Bool
     private let bytesLength: Int
 
-    private init(value: BigUInt, padding: Bool, bytesLength: Int) {
-        self.value = value
+    private init(bytes: [UInt8], padding: Bool, bytesLength: Int) {
+        self.bytes = bytes
         self.padding = padding
         self.bytesLength = bytesLength
     }
 
     func serialize() -> [UInt8] {
-        var bytes = value.serialize().bytes
-        if padding {
-            while bytes.count < bytesLength {
-                bytes.insert(0x00, at: 0)
-            }
+        guard padding && bytes.count < bytesLength else {
+            return bytes
         }
-        return bytes
+        var padded = [UInt8](repeating: 0x00, count: bytesLength - bytes.count)
+        padded.append(contentsOf: bytes)
+        return padded
     }
   
     public func hexString() -> String {
@@ -36,7 +36,7 @@ public struct BigNumber {
     }
 
     public var description: String {
-        return value.description
+        return BigUInt(Data(bytes: bytes)).description
     }
 
     /// - Requires: accepts text with these formats:
@@ -51,42 +51,49 @@ public struct BigNumber {
     /// If padding is true, 0x00 is padded to left to keep bytes length as input prefixed with 0s.
   public static func parse(_ text: String, padding: Bool = false, paddingLen: Int = -1) -> BigNumber {
         var padding = padding
-        var value: BigUInt
+        var bytes: [UInt8]
         var bytesLen: Int = 0
 
         if text.hasPrefix("#") {
             let t = text.tk_substring(from: 1)
-            value = BigUInt(extendedGraphemeClusterLiteral: t)
+            bytes = decimalBytes(t) ?? BigUInt(extendedGraphemeClusterLiteral: t).serialize().bytes
             bytesLen = bytesLength(of: t)
         } else if Hex.hasPrefix(text) {
             let t = Hex.removePrefix(text)
-            value = BigUInt(t, radix: 16)!
+            bytes = hexBytes(t) ?? BigUInt(t, radix: 16)!.serialize().bytes
             bytesLen = bytesLength(of: t)
         } else {
             if text.tk_isDigits {
                 // NOTE: if text is a hex string without alhpabet this won't work.
                 // It's just a simple guess. Better to pass in hex always prefixed with "0x".
 
-                value = BigUInt(Hex.removePrefix(text), radix: 10)!
+                bytes = decimalBytes(text) ?? BigUInt(text, radix: 10)!.serialize().bytes
                 padding = false
             } else if Hex.isHex(text) {
-                let t = Hex.removePrefix(text)
-                value = BigUInt(t, radix: 16)!
-                bytesLen = bytesLength(of: t)
+                bytes = hexBytes(text) ?? BigUInt(text, radix: 16)!.serialize().bytes
+                bytesLen = bytesLength(of: text)
             } else {
                 // Parse fail!
-                value = BigUInt(0)
+                bytes = []
             }
         }
     
         bytesLen = paddingLen != -1 ? paddingLen : bytesLen
 
-        return BigNumber(value: value, padding: padding, bytesLength: bytesLen)
+        return BigNumber(bytes: bytes, padding: padding, bytesLength: bytesLen)
     }
 
     private static func bytesLength(of string: String) -> Int {
         return (string.count + 1) / 2
     }
+
+    private static func decimalBytes(_ text: String) -> [UInt8]? {
+        return UInt256(decimal: text)?.serialize()
+    }
+
+    private static func hexBytes(_ text: String) -> [UInt8]? {
+        return UInt256(hex: text)?.serialize()
+    }
 }
 
 // MARK: - Converting Ints
@@ -96,11 +103,11 @@ extension BigNumber {
         bytesLength = 0
 
         if let int = v as? Int64 {
-            value = BigUInt(int)
+            bytes = UInt256(UInt64(int)).serialize()
         } else if let int = v as? Int {
-            value = BigUInt(int)
+            bytes = UInt256(UInt64(int)).serialize()
         } else if let int = v as? UInt8 {
-            value = BigUInt(int)
+            bytes = UInt256(UInt64(int)).serialize()
         } else {
             return nil
         }
@@ -11,22 +11,9 @@ import CryptoSwift
 
 extension Data {
   public func tk_toHexString() -> String {
-    return toHexString() // From CryptoSwift
-  }
-
-  func tk_hexToBitArray() -> [UInt] {
-    var bits = [UInt]()
-    let hex = tk_toHexString()
-
-    for char in hex {
-      let bin = Data.tk_hexCharToBinary(char: char)
-      for bit in bin {
-        //let c = String(format: "%C", String(bit))
-        bits.append(UInt(String(bit))!)
-      }
+    return withUnsafeBytes { (bytes: UnsafePointer<UInt8>) -> String in
+      Hex.encode(UnsafeBufferPointer(start: bytes, count: count))
     }
-
-    return bits
   }
 
   public static func tk_random(of length: Int) -> Data {
@@ -37,19 +24,6 @@ extension Data {
     return data
   }
 
-  /// Convert hex character to binary, if input is not a valid hex character, return "0000".
-  static func tk_hexCharToBinary(char: Character) -> String {
-    if let value = Int(String(char), radix: 16) {
-      var bin = String(value, radix: 2)
-      while bin.count < 4 {
-        bin = "0" + bin
-      }
-      return bin
-    } else {
-      return "0000"
-    }
-  }
-
   func tk_bigEndian() -> Data {
     if CFByteOrderGetCurrent() ==  Int(CFByteOrderBigEndian.rawValue) {
       return self
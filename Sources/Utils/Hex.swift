@@ -10,24 +10,91 @@ import Foundation
 
 public final class Hex {
   private static let prefix = "0x"
+  private static let invalidNibble: UInt8 = 0xff
+
+  // ASCII codes of lower case hex digits, indexed by nibble value.
+  private static let alphabet: [UInt8] = Array("0123456789abcdef".utf8)
+
+  // Nibble value of every ASCII code, `invalidNibble` for non hex characters.
+  private static let nibbles: [UInt8] = {
+    var table = [UInt8](repeating: invalidNibble, count: 256)
+    for (value, char) in "0123456789abcdef".utf8.enumerated() {
+      table[Int(char)] = UInt8(value)
+    }
+    for (value, char) in "ABCDEF".utf8.enumerated() {
+      table[Int(char)] = UInt8(value + 10)
+    }
+    return table
+  }()
 
   // The values refer to individual bytes, so the legal value range is between 0x00 and 0xFF (hex) or 0 and 255 (decimal).
+  // Pairs containing non hex characters are decoded as 0.
   static func toBytes(_ hex: String) -> [UInt8] {
-    let normalized = normalize(hex)
+    return decode(hex, strict: false) ?? []
+  }
 
-    var bytes = [UInt8]()
-    let length = normalized.count
+  static func hex(from bytes: [UInt8]) -> String {
+    return bytes.withUnsafeBufferPointer { encode($0) }
+  }
 
-    for i in stride(from: 0, to: length, by: 2) {
-      let num = normalized.tk_substring(from: i).tk_substring(to: 2)
-      bytes.append(UInt8(num, radix: 16) ?? 0)
+  /// Encode bytes to lower case hex string (without prefix) with one pass over a preallocated buffer.
+  static func encode(_ bytes: UnsafeBufferPointer<UInt8>) -> String {
+    var chars = [UInt8](repeating: 0, count: bytes.count * 2)
+    alphabet.withUnsafeBufferPointer { table in
+      chars.withUnsafeMutableBufferPointer { output in
+        var i = 0
+        for byte in bytes {
+          output[i] = table[Int(byte >> 4)]
+          output[i + 1] = table[Int(byte & 0x0f)]
+          i += 2
+        }
+      }
     }
-
-    return bytes
+    return String(decoding: chars, as: UTF8.self)
   }
 
-  static func hex(from bytes: [UInt8]) -> String {
-    return Data(bytes: bytes).tk_toHexString()
+  /// Decode a hex string, optionally prefixed with "0x". Odd length input is treated as left padded with '0'.
+  /// - Parameter strict: If true returns nil when input contains non hex characters,
+  ///     otherwise every byte with an invalid character is decoded as 0.
+  static func decode(_ hex: String, strict: Bool) -> [UInt8]? {
+    let digits = Array(hex.utf8)
+    let start = hasPrefix(hex) ? prefix.utf8.count : 0
+    let length = digits.count - start
+    var bytes = [UInt8](repeating: 0, count: (length + 1) / 2)
+
+    let valid = nibbles.withUnsafeBufferPointer { table -> Bool in
+      digits.withUnsafeBufferPointer { input -> Bool in
+        bytes.withUnsafeMutableBufferPointer { output -> Bool in
+          var i = start
+          var o = 0
+          if length % 2 == 1 {
+            let low = table[Int(input[i])]
+            if low == invalidNibble {
+              if strict { return false }
+            } else {
+              output[o] = low
+            }
+            i += 1
+            o += 1
+          }
+
+          while i < input.count {
+            let high = table[Int(input[i])]
+            let low = table[Int(input[i + 1])]
+            if (high | low) > 0x0f {
+              if strict { return false }
+            } else {
+              output[o] = high << 4 | low
+            }
+            i += 2
+            o += 1
+          }
+          return true
+        }
+      }
+    }
+
+    return valid ? bytes : nil
   }
 
   static func removePrefix(_ hex: String) -> String {
@@ -51,17 +118,28 @@ public final class Hex {
   }
 
   static func isHex(_ string: String) -> Bool {
-    if hasPrefix(string) {
-      return isHex(string.tk_substring(from: 2))
-    }
+    let utf8 = string.utf8
+    let start = hasPrefix(string) ? prefix.utf8.count : 0
+    let length = utf8.count - start
 
-    if string.count % 2 != 0 {
+    if length == 0 || length % 2 != 0 {
       return false
     }
-    
-    let regex = "^[A-Fa-f0-9]+$"
-    let predicate = NSPredicate(format: "SELF MATCHES %@", regex)
-    return predicate.evaluate(with: string)
+
+    return nibbles.withUnsafeBufferPointer { table in
+      !utf8.dropFirst(start).contains { table[Int($0)] == invalidNibble }
+    }
+  }
+
+  /// Whether an ASCII code is 0-9, a-f or A-F.
+  static func isHexDigit(_ char: UInt8) -> Bool {
+    return nibble(char) != nil
+  }
+
+  /// Value of a hex digit ASCII code, nil for non hex characters.
+  static func nibble(_ char: UInt8) -> UInt8? {
+    let value = nibbles[Int(char)]
+    return value == invalidNibble ? nil : value
   }
 
   // Add '0' to left if length is not even
@@ -80,51 +158,18 @@ public final class Hex {
 
 public extension String {
   public func tk_toHexString() -> String {
-    return data(using: .utf8)!.tk_toHexString()
+    return Hex.hex(from: Array(utf8))
   }
 
   func tk_fromHexString() -> String {
-    if Hex.hasPrefix(self) {
-      return tk_substring(from: 2).tk_fromHexString()
-    }
-
-    let bytes = [UInt8](hex: self)
-    return String(bytes: bytes, encoding: .ascii)!
+    return String(bytes: Hex.toBytes(self), encoding: .ascii)!
   }
 
   func tk_dataFromHexString() -> Data? {
-    if Hex.hasPrefix(self) {
-      return tk_substring(from: 2).tk_dataFromHexString()
-    }
-
-    let length = count
-
-    if length % 2 == 1 {
-      return ("0" + self).tk_dataFromHexString()
-    }
-
-    if isEmpty {
-      return Data()
-    }
-
-    if !Hex.isHex(self) {
+    guard let bytes = Hex.decode(self, strict: true) else {
       return nil
     }
-
-    guard let chars = cString(using: .utf8) else { return nil}
-
-    guard let data = NSMutableData(capacity: length / 2) else { return nil }
-    var byteChars: [CChar] = [0, 0, 0]
-    var wholeByte: CUnsignedLong = 0
-
-    for i in stride(from: 0, to: length, by: 2) {
-      byteChars[0] = chars[i]
-      byteChars[1] = chars[i + 1]
-      wholeByte = strtoul(byteChars, nil, 16)
-      data.append(&wholeByte, length: 1)
-    }
-
-    return data as Data
+    return Data(bytes: bytes)
   }
 
   func tk_isHex() -> Bool {
@@ -0,0 +1,47 @@
+//
+//  OpenSSLThreading.c
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+// CoreBitcoin keys, keychains and signatures compute on OpenSSL 1.0.2, which is only thread safe once locking callbacks are installed.
+// They're installed when the framework loads, before any CoreBitcoin call, unless the host app has installed its own.
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <openssl/crypto.h>
+
+static pthread_mutex_t *tk_openssl_locks;
+
+static void tk_openssl_locking(int mode, int n, const char *file, int line) {
+  if (mode & CRYPTO_LOCK) {
+    pthread_mutex_lock(&tk_openssl_locks[n]);
+  } else {
+    pthread_mutex_unlock(&tk_openssl_locks[n]);
+  }
+}
+
+static void tk_openssl_thread_id(CRYPTO_THREADID *id) {
+  CRYPTO_THREADID_set_pointer(id, (void *)pthread_self());
+}
+
+__attribute__((constructor))
+static void tk_openssl_install_locking(void) {
+  if (CRYPTO_get_locking_callback() != NULL) {
+    return;
+  }
+
+  int count = CRYPTO_num_locks();
+  tk_openssl_locks = malloc(count * sizeof(pthread_mutex_t));
+  if (tk_openssl_locks == NULL) {
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    pthread_mutex_init(&tk_openssl_locks[i], NULL);
+  }
+
+  CRYPTO_THREADID_set_callback(tk_openssl_thread_id);
+  CRYPTO_set_locking_callback(tk_openssl_locking);
+}
@@ -11,74 +11,225 @@ import Foundation
 // Wiki: https://github.com/ethereum/wiki/wiki/RLP
 public class RLP {
   static let shortLengthLimit        = 56
-  static let longLengthLimit         = pow(256, 8)
   static let primitivePrefixOffset   = 0x80
   static let listPrefixOffset        = 0xc0
 
   typealias Byte = UInt8
   typealias ByteArray = [UInt8]
 
+  /// Typed item to encode.
+  indirect enum Item {
+    case bytes(ByteArray)
+    case list([Item])
+  }
+
+  /// Decoded item, byte strings are slices of the decoded input and share its storage.
+  indirect enum Decoded {
+    case bytes(ArraySlice<Byte>)
+    case list([Decoded])
+  }
+
   public static func encode(_ input: Any) -> String {
     let bytes: ByteArray = encode(input)
     return Hex.hex(from: bytes)
   }
 
   static func encode(_ input: Any) -> ByteArray {
+    guard let item = item(from: input) else {
+      return []
+    }
+    return encode(item)
+  }
+
+  /// Encode in two passes: measure the whole output first, then write it into one preallocated buffer.
+  static func encode(_ item: Item) -> ByteArray {
+    var listPayloadLengths = [Int]()
+    let length = measure(item, listPayloadLengths: &listPayloadLengths)
+
+    var output = ByteArray(repeating: 0, count: length)
+    output.withUnsafeMutableBufferPointer { buffer in
+      var offset = 0
+      var listIndex = 0
+      write(item, to: buffer, offset: &offset, listPayloadLengths: listPayloadLengths, listIndex: &listIndex)
+    }
+    return output
+  }
+
+  /// Decode one RLP item, the whole input must be consumed.
+  static func decode(_ input: ArraySlice<Byte>) throws -> Decoded {
+    var offset = input.startIndex
+    let decoded = try decode(input, offset: &offset)
+    guard offset == input.endIndex else {
+      throw RLPError.invalid
+    }
+    return decoded
+  }
+
+  static func decode(_ input: ByteArray) throws -> Decoded {
+    return try decode(input[...])
+  }
+}
+
+// MARK: - Converting untyped input
+private extension RLP {
+  static func item(from input: Any) -> Item? {
     if let string = input as? String {
       if string.hasPrefix("#") {
-        return encode(bigNum: BigNumber.parse(string))
+        return .bytes(BigNumber.parse(string).serialize())
       } else {
-        return encode(string: string)
+        return .bytes(Array(string.utf8))
       }
     }
 
     if let bigNum = (input as? BigNumber) ?? BigNumber(input) {
-      return encode(bigNum: bigNum)
+      return .bytes(bigNum.serialize())
     }
 
     if let array = input as? [Any] {
-      return encode(list: array)
+      return .list(array.compactMap { item(from: $0) })
     }
 
-    return []
+    return nil
   }
 }
 
+// MARK: - Encoding
 private extension RLP {
-  static func encode(bytes: ByteArray) -> ByteArray {
-    if bytes.count == 1 && Int(bytes.first!) < primitivePrefixOffset {
-      return bytes
-    } else {
-      return encode(length: bytes.count, offset: primitivePrefixOffset) + bytes
+  static func measure(_ item: Item, listPayloadLengths: inout [Int]) -> Int {
+    switch item {
+    case .bytes(let bytes):
+      if isSingleByte(bytes) {
+        return 1
+      }
+      return headerLength(payloadLength: bytes.count) + bytes.count
+    case .list(let items):
+      let index = listPayloadLengths.count
+      listPayloadLengths.append(0)
+      var payloadLength = 0
+      for child in items {
+        payloadLength += measure(child, listPayloadLengths: &listPayloadLengths)
+      }
+      listPayloadLengths[index] = payloadLength
+      return headerLength(payloadLength: payloadLength) + payloadLength
+    }
+  }
+
+  static func write(_ item: Item, to buffer: UnsafeMutableBufferPointer<Byte>, offset: inout Int, listPayloadLengths: [Int], listIndex: inout Int) {
+    switch item {
+    case .bytes(let bytes):
+      if isSingleByte(bytes) {
+        buffer[offset] = bytes[0]
+        offset += 1
+        return
+      }
+      writeHeader(length: bytes.count, offset: primitivePrefixOffset, to: buffer, at: &offset)
+      for byte in bytes {
+        buffer[offset] = byte
+        offset += 1
+      }
+    case .list(let items):
+      let payloadLength = listPayloadLengths[listIndex]
+      listIndex += 1
+      writeHeader(length: payloadLength, offset: listPrefixOffset, to: buffer, at: &offset)
+      for child in items {
+        write(child, to: buffer, offset: &offset, listPayloadLengths: listPayloadLengths, listIndex: &listIndex)
+      }
     }
   }
 
-  static func encode(string: String) -> ByteArray {
-    return encode(bytes: Array(string.utf8))
+  static func writeHeader(length: Int, offset prefixOffset: Int, to buffer: UnsafeMutableBufferPointer<Byte>, at offset: inout Int) {
+    if length < shortLengthLimit {
+      buffer[offset] = Byte(length + prefixOffset)
+      offset += 1
+      return
+    }
+
+    let lengthBytes = byteCount(of: length)
+    buffer[offset] = Byte(lengthBytes + prefixOffset + shortLengthLimit - 1)
+    offset += 1
+    for i in (0..<lengthBytes).reversed() {
+      buffer[offset] = Byte(truncatingIfNeeded: length >> (i * 8))
+      offset += 1
+    }
   }
 
-  static func encode(bigNum: BigNumber) -> ByteArray {
-    return encode(bytes: bigNum.serialize())
+  static func isSingleByte(_ bytes: ByteArray) -> Bool {
+    return bytes.count == 1 && Int(bytes[0]) < primitivePrefixOffset
   }
 
-  static func encode(list: [Any]) -> ByteArray {
-    var result = ByteArray()
-    for item in list {
-      let encodedItem: ByteArray = encode(item)
-      result += encodedItem
+  static func headerLength(payloadLength: Int) -> Int {
+    return payloadLength < shortLengthLimit ? 1 : 1 + byteCount(of: payloadLength)
+  }
+
+  static func byteCount(of length: Int) -> Int {
+    var count = 0
+    var value = length
+    while value > 0 {
+      count += 1
+      value >>= 8
     }
-    return encode(length: result.count, offset: listPrefixOffset) + result
+    return count
   }
+}
 
-  static func encode(length: Int, offset: Int) -> ByteArray {
-    if length < shortLengthLimit {
-      return [Byte(length + offset)]
-    } else if Decimal(length) < longLengthLimit {
-      let hex = String(length, radix: 16)
-      let binary = Hex.toBytes(Hex.pad(hex))
-      return [Byte(binary.count + offset + shortLengthLimit - 1)] + binary
+// MARK: - Decoding
+private extension RLP {
+  static func decode(_ input: ArraySlice<Byte>, offset: inout Int) throws -> Decoded {
+    guard offset < input.endIndex else {
+      throw RLPError.invalid
+    }
+
+    let prefix = Int(input[offset])
+    if prefix < primitivePrefixOffset {
+      offset += 1
+      return .bytes(input[(offset - 1)..<offset])
+    }
+
+    let isList = prefix >= listPrefixOffset
+    let payloadLength = try decodeLength(input, prefix: prefix - (isList ? listPrefixOffset : primitivePrefixOffset), offset: &offset)
+    let end = offset + payloadLength
+    guard end <= input.endIndex else {
+      throw RLPError.invalid
     }
 
-    return []
+    if !isList {
+      let bytes = input[offset..<end]
+      // A single byte below 0x80 must be encoded as itself
+      if payloadLength == 1 && Int(bytes[offset]) < primitivePrefixOffset {
+        throw RLPError.invalid
+      }
+      offset = end
+      return .bytes(bytes)
+    }
+
+    var items = [Decoded]()
+    while offset < end {
+      items.append(try decode(input[..<end], offset: &offset))
+    }
+    return .list(items)
+  }
+
+  /// Read the payload length following a prefix (already reduced by its offset), and move past the header.
+  static func decodeLength(_ input: ArraySlice<Byte>, prefix: Int, offset: inout Int) throws -> Int {
+    offset += 1
+    if prefix < shortLengthLimit {
+      return prefix
+    }
+
+    let lengthBytes = prefix - shortLengthLimit + 1
+    guard lengthBytes <= MemoryLayout<Int32>.size, offset + lengthBytes <= input.endIndex, input[offset] != 0 else {
+      throw RLPError.invalid
+    }
+
+    var length = 0
+    for byte in input[offset..<(offset + lengthBytes)] {
+      length = length << 8 | Int(byte)
+    }
+    offset += lengthBytes
+
+    guard length >= shortLengthLimit else {
+      throw RLPError.invalid
+    }
+    return length
   }
 }
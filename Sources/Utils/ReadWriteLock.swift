@@ -0,0 +1,39 @@
+//
+//  ReadWriteLock.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Many readers or one writer, over pthread_rwlock.
+/// Readers never wait for each other, only for a writer in progress.
+/// The rwlock lives in its own allocation, pthread primitives must not move and a stored property has no stable address.
+final class ReadWriteLock {
+  private let lock = UnsafeMutablePointer<pthread_rwlock_t>.allocate(capacity: 1)
+
+  init() {
+    lock.initialize(to: pthread_rwlock_t())
+    pthread_rwlock_init(lock, nil)
+  }
+
+  deinit {
+    pthread_rwlock_destroy(lock)
+    lock.deinitialize(count: 1)
+    lock.deallocate()
+  }
+
+  func read<T>(_ body: () throws -> T) rethrows -> T {
+    pthread_rwlock_rdlock(lock)
+    defer { pthread_rwlock_unlock(lock) }
+    return try body()
+  }
+
+  func write<T>(_ body: () throws -> T) rethrows -> T {
+    pthread_rwlock_wrlock(lock)
+    defer { pthread_rwlock_unlock(lock) }
+    return try body()
+  }
+}
@@ -0,0 +1,39 @@
+//
+//  SecureBytes.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Bytes kept in memory locked from being paged out, and zeroed before being freed.
+final class SecureBytes {
+  let count: Int
+  private let pointer: UnsafeMutablePointer<UInt8>
+  private let isLocked: Bool
+
+  init(_ bytes: [UInt8]) {
+    count = bytes.count
+    pointer = UnsafeMutablePointer<UInt8>.allocate(capacity: max(count, 1))
+    isLocked = mlock(pointer, count) == 0
+    pointer.initialize(from: bytes, count: count)
+  }
+
+  deinit {
+    wipe()
+    if isLocked {
+      munlock(pointer, count)
+    }
+    pointer.deallocate()
+  }
+
+  var bytes: [UInt8] {
+    return Array(UnsafeBufferPointer(start: pointer, count: count))
+  }
+
+  func wipe() {
+    _ = memset_s(pointer, count, 0, count)
+  }
+}
@@ -20,11 +20,37 @@ public struct SigUtil {
   }
 
   public static func batchEcsign(with privateKey: String, data: [String]) -> [ECSignature] {
-    return data.map { ecsign(with: privateKey, data: $0) }
+    let signer = Encryptor.Secp256k1.Signer(key: privateKey)
+    return data.map { hash in
+      guard let signer = signer, let hashBytes = hash.tk_dataFromHexString()?.bytes else {
+        return signature(from: Encryptor.Secp256k1.failureSignResult)
+      }
+      return signature(from: signer.sign(hash: hashBytes))
+    }
+  }
+
+  /// Sign 32 bytes hashes laid out back to back with one key.
+  /// - Returns: 65 bytes r, s and v for each hash, nil if key or hashes are invalid.
+  public static func batchEcsign(with privateKey: String, hashes: [UInt8], concurrently: Bool = true) -> [UInt8]? {
+    return Encryptor.Secp256k1.Signer(key: privateKey)?.signPacked(hashes: hashes, concurrently: concurrently)
+  }
+
+  /// personal_sign every message with one key.
+  /// - Returns: 65 bytes r, s and v for each message, nil if key is invalid.
+  public static func batchPersonalSign(privateKey: String, messages: [String], concurrently: Bool = true) -> [UInt8]? {
+    var hashes = [UInt8]()
+    hashes.reserveCapacity(messages.count * 32)
+    for message in messages {
+      hashes.append(contentsOf: personalMessageHash(message))
+    }
+    return batchEcsign(with: privateKey, hashes: hashes, concurrently: concurrently)
   }
 
   public static func ecsign(with privateKey: String, data: String) -> ECSignature {
-    let result = Encryptor.Secp256k1().sign(key: privateKey, message: data)
+    return signature(from: Encryptor.Secp256k1().sign(key: privateKey, message: data))
+  }
+
+  private static func signature(from result: Encryptor.SignResult) -> ECSignature {
     let v = result.recid + 27
     let r = result.signature.tk_substring(to: 64)
     let s = result.signature.tk_substring(from: 64)
@@ -35,9 +61,67 @@ public struct SigUtil {
     return Encryptor.Secp256k1().recover(signature: signature, message: msgHash, recid: recid)
   }
 
+  /// Recover public keys of signatures produced by `batchEcsign(with:hashes:)`.
+  /// - Parameter hashes: 32 bytes hashes back to back.
+  /// - Parameter signatures: 65 bytes r, s and v for each hash.
+  /// - Returns: 65 bytes uncompressed public key for each signature, zero filled where recovery fails. nil if lengths don't match.
+  public static func batchEcrecover(hashes: [UInt8], signatures: [UInt8], concurrently: Bool = true) -> [UInt8]? {
+    guard signatures.count % 65 == 0 else {
+      return nil
+    }
+
+    let count = signatures.count / 65
+    var compactSignatures = [UInt8]()
+    compactSignatures.reserveCapacity(count * 64)
+    var recids = [Int32]()
+    recids.reserveCapacity(count)
+    for i in 0..<count {
+      compactSignatures.append(contentsOf: signatures[(i * 65)..<(i * 65 + 64)])
+      let v = Int32(signatures[i * 65 + 64])
+      recids.append(v >= 27 ? v - 27 : v)
+    }
+    return Encryptor.Secp256k1.Recoverer.shared.recoverPacked(hashes: hashes, signatures: compactSignatures, recids: recids, concurrently: concurrently)
+  }
+
+  /// Recover addresses (hex without 0x) of packed signatures, nil for each signature that fails to recover.
+  public static func batchRecoverAddresses(hashes: [UInt8], signatures: [UInt8], concurrently: Bool = true) -> [String?]? {
+    guard let publicKeys = batchEcrecover(hashes: hashes, signatures: signatures, concurrently: concurrently) else {
+      return nil
+    }
+
+    var hash = [UInt8](repeating: 0, count: 32)
+    return publicKeys.withUnsafeBufferPointer { keys in
+      (0..<(keys.count / 65)).map { i -> String? in
+        let offset = i * 65
+        guard keys[offset] == 0x04 else {
+          return nil
+        }
+        tk_keccak256(keys.baseAddress! + offset + 1, 64, &hash)
+        return Hex.hex(from: Array(hash.suffix(20)))
+      }
+    }
+  }
+
+  /// Check whether each packed signature of the hash was made by the key of the address.
+  public static func batchVerify(hashes: [UInt8], signatures: [UInt8], addresses: [String], concurrently: Bool = true) -> [Bool] {
+    guard let recovered = batchRecoverAddresses(hashes: hashes, signatures: signatures, concurrently: concurrently),
+      recovered.count == addresses.count else {
+      return addresses.map { _ in false }
+    }
+    return zip(recovered, addresses).map { recoveredAddress, address in
+      recoveredAddress != nil && recoveredAddress == address.removePrefix0xIfNeeded().lowercased()
+    }
+  }
+
   public static func hashPersonalMessage(_ msg: String) -> String {
-    let prefix = "\u{0019}Ethereum Signed Message:\n\(String(msg.lengthOfBytes(using: .utf8)))"
-    return Encryptor.Keccak256().encrypt(hex: (prefix + msg).tk_toHexString())
+    return Hex.hex(from: personalMessageHash(msg))
+  }
+
+  static func personalMessageHash(_ msg: String) -> [UInt8] {
+    let message = Array(msg.utf8)
+    var bytes = Array("\u{0019}Ethereum Signed Message:\n\(message.count)".utf8)
+    bytes.append(contentsOf: message)
+    return Encryptor.Keccak256().calculate(for: bytes)
   }
 
   public static func concatSig(v: Int32, r: String, s: String) -> String {
@@ -10,9 +10,7 @@ import Foundation
 
 public extension String {
   var tk_isDigits: Bool {
-    let regex = "^[0-9]+$"
-    let predicate = NSPredicate(format: "SELF MATCHES %@", regex)
-    return predicate.evaluate(with: self)
+    return !isEmpty && !utf8.contains { $0 < 0x30 || $0 > 0x39 }
   }
 
   func tk_substring(from: Int) -> String {
@@ -0,0 +1,121 @@
+//
+//  UInt256.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Fixed width 256 bits unsigned integer in four 64 bits words, which covers every numeric Ethereum transaction field.
+/// Parses decimal and hex text and serializes to minimal big endian bytes without heap allocated arithmetic.
+struct UInt256: Equatable {
+  // Least significant word first
+  private var w0: UInt64 = 0
+  private var w1: UInt64 = 0
+  private var w2: UInt64 = 0
+  private var w3: UInt64 = 0
+
+  private static let maxChunkDigits = 19 // 10^19 fits in UInt64
+  private static let powersOf10: [UInt64] = (0...maxChunkDigits).map { n in
+    (0..<n).reduce(1) { power, _ in power * 10 }
+  }
+
+  init() {}
+
+  init(_ value: UInt64) {
+    w0 = value
+  }
+
+  /// - Returns: nil if text is empty, has non digit characters or overflows 256 bits.
+  init?(decimal text: String) {
+    let digits = text.utf8
+    guard !digits.isEmpty else {
+      return nil
+    }
+
+    // Fold digits in chunks of 19 into one 64 bits multiply-add each
+    var chunk: UInt64 = 0
+    var chunkDigits = 0
+    for char in digits {
+      guard char >= 0x30 && char <= 0x39 else {
+        return nil
+      }
+      chunk = chunk * 10 + UInt64(char - 0x30)
+      chunkDigits += 1
+      if chunkDigits == UInt256.maxChunkDigits {
+        guard multiply(by: UInt256.powersOf10[chunkDigits], adding: chunk) else {
+          return nil
+        }
+        chunk = 0
+        chunkDigits = 0
+      }
+    }
+    if chunkDigits > 0 {
+      guard multiply(by: UInt256.powersOf10[chunkDigits], adding: chunk) else {
+        return nil
+      }
+    }
+  }
+
+  /// - Parameter text: Hex digits, optionally prefixed with 0x.
+  /// - Returns: nil if there's no digit, text has non hex characters or overflows 256 bits.
+  init?(hex text: String) {
+    let digits = text.utf8.dropFirst(Hex.hasPrefix(text) ? 2 : 0)
+    guard !digits.isEmpty else {
+      return nil
+    }
+
+    for char in digits {
+      guard let nibble = Hex.nibble(char), w3 >> 60 == 0 else {
+        return nil
+      }
+      w3 = w3 << 4 | w2 >> 60
+      w2 = w2 << 4 | w1 >> 60
+      w1 = w1 << 4 | w0 >> 60
+      w0 = w0 << 4 | UInt64(nibble)
+    }
+  }
+
+  /// Big endian bytes without leading zeros, empty for zero.
+  func serialize() -> [UInt8] {
+    let words = [w3, w2, w1, w0]
+    guard let top = words.index(where: { $0 != 0 }) else {
+      return []
+    }
+
+    let topBytes = (UInt64.bitWidth - words[top].leadingZeroBitCount + 7) / 8
+    var bytes = [UInt8](repeating: 0, count: topBytes + (words.count - top - 1) * 8)
+    var offset = 0
+    for (i, word) in words.enumerated().dropFirst(top) {
+      let byteCount = i == top ? topBytes : 8
+      for shift in (0..<byteCount).reversed() {
+        bytes[offset] = UInt8(truncatingIfNeeded: word >> UInt64(shift * 8))
+        offset += 1
+      }
+    }
+    return bytes
+  }
+
+  /// self = self * multiplier + addend.
+  /// - Returns: false if the result overflows 256 bits.
+  private mutating func multiply(by multiplier: UInt64, adding addend: UInt64) -> Bool {
+    var carry = addend
+    func step(_ word: inout UInt64) {
+      let product = word.multipliedFullWidth(by: multiplier)
+      let (sum, overflow) = product.low.addingReportingOverflow(carry)
+      word = sum
+      carry = product.high + (overflow ? 1 : 0) // high is at most multiplier - 1, never overflows
+    }
+    step(&w0)
+    step(&w1)
+    step(&w2)
+    step(&w3)
+    return carry == 0
+  }
+
+  static func == (lhs: UInt256, rhs: UInt256) -> Bool {
+    return lhs.w0 == rhs.w0 && lhs.w1 == rhs.w1 && lhs.w2 == rhs.w2 && lhs.w3 == rhs.w3
+  }
+}
@@ -11,31 +11,21 @@ import Foundation
 public class AddressValidator: Validator {
   public typealias Result = String
   private let address: String
-  private let formatRegex = "^(0x)?[0-9a-f]{40}$"
 
   public init(address: String) {
     self.address = address
   }
 
+  /// 40 hex digits in any case, optionally prefixed with 0x in any case.
   var isFormatValid: Bool {
-    let predicate = NSPredicate(format: "SELF MATCHES[c] %@", formatRegex)
-    return predicate.evaluate(with: address)
+    let utf8 = address.utf8
+    let hasPrefix = utf8.count >= 2 && utf8.first == 0x30 && (utf8.dropFirst().first! | 0x20) == 0x78 // 0x, 0X
+    let digits = utf8.dropFirst(hasPrefix ? 2 : 0)
+    return digits.count == 40 && !digits.contains { !Hex.isHexDigit($0) }
   }
 
   var isChecksumValid: Bool {
-    let address = Hex.removePrefix(self.address.lowercased())
-    let hash = Encryptor.Keccak256().encrypt(hex: address.tk_toHexString())
-
-    let checksumed = address.enumerated().map { (index, char) in
-      let hashedValue = hash.tk_substring(from: index).tk_substring(to: 1)
-      if Int(hashedValue, radix: 16)! >= 8 {
-        return String(char).uppercased()
-      } else {
-        return String(char)
-      }
-    }.joined()
-
-    return Hex.addPrefix(checksumed) == self.address
+    return Hex.hasPrefix(address) && EIP55.isValid(address)
   }
 
   public var isValid: Bool {
@@ -53,8 +43,15 @@ public class AddressValidator: Validator {
     return address
   }
 
+  /// Validate addresses in bulk, e.g. of an address book.
+  public static func isValid(addresses: [String]) -> [Bool] {
+    return addresses.map { AddressValidator(address: $0).isValid }
+  }
+
   private var sameCase: Bool {
-    let val = Hex.removePrefix(address)
-    return val == val.lowercased() || val == val.uppercased()
+    let letters = Hex.removePrefix(address).utf8
+    let hasLower = letters.contains { 0x61...0x7a ~= $0 }
+    let hasUpper = letters.contains { 0x41...0x5a ~= $0 }
+    return !(hasLower && hasUpper)
   }
 }
@@ -7,7 +7,6 @@
 //
 
 import Foundation
-import CoreBitcoin
 
 public class MnemonicValidator: Validator {
   public typealias Result = String
@@ -37,13 +36,12 @@ public class MnemonicValidator: Validator {
 
   var isWordListValid: Bool {
     return !words.contains(where: { word -> Bool in
-      !MnemonicDictionary.dictionary.contains(word)
+      MnemonicDictionary.index(of: word) == nil
     })
   }
 
   var isChecksumValid: Bool {
-    let btcMnemonic = BTCMnemonic(words: words, password: "", wordListType: BTCMnemonicWordListType.english)
-    return btcMnemonic != nil
+    return (try? MnemonicCodec.entropy(from: words)) != nil
   }
 
   public var isValid: Bool {
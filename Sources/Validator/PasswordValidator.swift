@@ -11,7 +11,9 @@ import Foundation
 public class PasswordValidator: Validator {
   public typealias Result = String
   private let password: String
-  private let formatRegex = "^.{8,}$"
+  private static let minimumLength = 8
+  // Characters "." of the former "^.{8,}$" regex never matched
+  private static let lineTerminators: Set<Unicode.Scalar> = ["\n", "\u{0B}", "\u{0C}", "\r", "\u{85}", "\u{2028}", "\u{2029}"]
 
   public init(_ password: String) {
     self.password = password
@@ -29,8 +31,8 @@ public class PasswordValidator: Validator {
   }
 
   var isFormatValid: Bool {
-    let predicate = NSPredicate(format: "SELF MATCHES %@", formatRegex)
-    return predicate.evaluate(with: password)
+    let scalars = password.unicodeScalars
+    return scalars.count >= PasswordValidator.minimumLength && !scalars.contains { PasswordValidator.lineTerminators.contains($0) }
   }
 
   public var isValid: Bool {
@@ -12,17 +12,37 @@ public typealias WalletID = String
 
 public class BasicWallet {
   public var walletID: WalletID
-  public var keystore: Keystore
   public let chainType: ChainType?
 
-  public init(json: JSONObject) throws {
+  private enum KeystoreState {
+    case loaded(Keystore)
+    /// Listed in the identity wallet index, keystore not parsed yet
+    case indexed(WalletSummary, loader: () -> Keystore?)
+  }
+
+  private var keystoreState: KeystoreState
+  private let keystoreLock = NSLock()
+  /// Serializes changes built from the current keystore, e.g. switching BTC address type, per wallet.
+  private let mutationLock = NSLock()
+
+  public convenience init(json: JSONObject) throws {
+    try self.init(fields: .json(json))
+  }
+
+  convenience init(fields: KeystoreFields) throws {
+    self.init(try BasicWallet.keystore(fields: fields))
+  }
+
+  /// Keystore of the type its version, chain and source call for.
+  /// - Throws: KeystoreError.invalid if fields are not a keystore of a known type
+  static func keystore(fields: KeystoreFields) throws -> Keystore {
     do {
       guard
-        let version = json["version"] as? Int,
-        let meta = json[WalletMeta.key] as? JSONObject,
-        let chainTypeStr = meta["chain"] as? String,
+        let version = fields.int("version"),
+        let meta = fields.object(WalletMeta.key),
+        let chainTypeStr = meta.string("chain"),
         let chainType = ChainType(rawValue: chainTypeStr),
-        let sourceStr = meta["source"] as? String,
+        let sourceStr = meta.string("source"),
         let source = WalletMeta.Source(rawValue: sourceStr)
       else {
         throw KeystoreError.invalid
@@ -39,91 +59,174 @@ public class BasicWallet {
         switch chainType {
         case .eth:
           if mnemonicKeystoreSource.contains(source) {
-            self.keystore = try ETHMnemonicKeystore(json: json)
+            return try ETHMnemonicKeystore(fields: fields)
           } else {
-            self.keystore = try ETHKeystore(json: json)
+            return try ETHKeystore(fields: fields)
           }
         case .btc:
-          self.keystore = try BTCKeystore(json: json)
+          return try BTCKeystore(fields: fields)
         case .eos:
-          self.keystore = try EOSLegacyKeystore(json: json)
+          return try EOSLegacyKeystore(fields: fields)
         }
       case BTCMnemonicKeystore.defaultVersion:
-        self.keystore = try BTCMnemonicKeystore(json: json)
+        return try BTCMnemonicKeystore(fields: fields)
       case EOSKeystore.defaultVersion:
-        self.keystore = try EOSKeystore(json: json)
+        return try EOSKeystore(fields: fields)
       default:
         throw KeystoreError.invalid
       }
-      self.chainType = chainType
     } catch {
       throw KeystoreError.invalid
     }
-    self.walletID = self.keystore.id
   }
 
   public init(_ keystore: Keystore) {
     self.walletID = keystore.id
-    self.keystore = keystore
+    keystoreState = .loaded(keystore)
     chainType = keystore.meta.chain
   }
 
+  /// Wallet whose keystore is loaded on first use.
+  init(summary: WalletSummary, keystoreLoader: @escaping () -> Keystore?) {
+    walletID = summary.walletID
+    chainType = summary.chainType
+    keystoreState = .indexed(summary, loader: keystoreLoader)
+  }
+
+  /// Keystore of the wallet, parsed on first use for wallets loaded from the identity wallet index.
+  /// - Throws: GenericError.walletNotFound if the keystore is missing from storage or can't be parsed
+  public func loadKeystore() throws -> Keystore {
+    keystoreLock.lock()
+    defer { keystoreLock.unlock() }
+    switch keystoreState {
+    case .loaded(let keystore):
+      return keystore
+    case .indexed(_, let loader):
+      guard let keystore = loader() else {
+        debugPrint("Keystore of wallet \(walletID) is missing or invalid")
+        throw GenericError.walletNotFound
+      }
+      keystoreState = .loaded(keystore)
+      return keystore
+    }
+  }
+
+  /// Swap in a keystore, e.g. one whose address changed.
+  func setKeystore(_ keystore: Keystore) {
+    keystoreLock.lock()
+    keystoreState = .loaded(keystore)
+    keystoreLock.unlock()
+  }
+
+  /// Keystore of the wallet, stops the process if it can't be loaded.
+  @available(*, deprecated, message: "Use loadKeystore(), which throws if the keystore is missing or invalid")
+  public var keystore: Keystore {
+    get {
+      guard let keystore = try? loadKeystore() else {
+        preconditionFailure("Keystore of wallet \(walletID) is missing or invalid")
+      }
+      return keystore
+    }
+    set {
+      setKeystore(newValue)
+    }
+  }
+
   public var address: String {
-    return keystore.address
+    switch currentState {
+    case .loaded(let keystore):
+      return keystore.address
+    case .indexed(let summary, _):
+      return summary.address
+    }
+  }
+
+  var summary: WalletSummary? {
+    switch currentState {
+    case .loaded(let keystore):
+      return WalletSummary(keystore)
+    case .indexed(let summary, _):
+      return summary
+    }
+  }
+
+  var isKeystoreLoaded: Bool {
+    if case .loaded = currentState {
+      return true
+    }
+    return false
+  }
+
+  func withMutationLock<T>(_ body: () throws -> T) rethrows -> T {
+    mutationLock.lock()
+    defer { mutationLock.unlock() }
+    return try body()
+  }
+
+  private var currentState: KeystoreState {
+    keystoreLock.lock()
+    defer { keystoreLock.unlock() }
+    return keystoreState
   }
 
   public var imTokenMeta: WalletMeta {
-    return keystore.meta
+    switch currentState {
+    case .loaded(let keystore):
+      return keystore.meta
+    case .indexed(let summary, _):
+      return summary.meta
+    }
   }
 }
 
 public extension BasicWallet {
   func exportMnemonic(password: String) throws -> String {
-    guard let mnemonicKeystore = self.keystore as? EncMnemonicKeystore else {
+    let keystore = try loadKeystore()
+    guard let mnemonicKeystore = keystore as? EncMnemonicKeystore else {
       throw GenericError.operationUnsupported
     }
 
-    guard keystore.verify(password: password) else {
-      throw PasswordError.incorrect
+    return try withUnlockSession(keystore, password: password) {
+      return mnemonicKeystore.decryptMnemonic(try keystore.unlock(password: password))
     }
-
-    return mnemonicKeystore.decryptMnemonic(password)
   }
 
-  func export() -> String {
-    if let exportableKeystore = keystore as? ExportableKeystore {
+  func export() throws -> String {
+    if let exportableKeystore = try loadKeystore() as? ExportableKeystore {
       return exportableKeystore.export()
     }
     return ""
   }
 
   public func privateKey(password: String) throws -> String {
-    guard keystore.verify(password: password) else {
-      throw PasswordError.incorrect
-    }
+    let keystore = try loadKeystore()
+    return try withUnlockSession(keystore, password: password) {
+      let unlocked = try keystore.unlock(password: password)
 
-    if let pkKestore = keystore as? PrivateKeyCrypto {
-      return pkKestore.decryptPrivateKey(password)
-    } else if let wifKeystore = keystore as? WIFCrypto {
-      return wifKeystore.decryptWIF(password)
-    } else if let xprvKeystore = keystore as? XPrvCrypto {
-      return xprvKeystore.decryptXPrv(password)
-    } else {
-      throw GenericError.operationUnsupported
+      if let pkKestore = keystore as? PrivateKeyCrypto {
+        return pkKestore.decryptPrivateKey(unlocked)
+      } else if let wifKeystore = keystore as? WIFCrypto {
+        return wifKeystore.decryptWIF(unlocked)
+      } else if let xprvKeystore = keystore as? XPrvCrypto {
+        return xprvKeystore.decryptXPrv(unlocked)
+      } else {
+        throw GenericError.operationUnsupported
+      }
     }
   }
 
   func privateKeys(password: String) throws -> [KeyPair] {
-    guard keystore.verify(password: password) else {
-      throw PasswordError.incorrect
-    }
+    let keystore = try loadKeystore()
+    return try withUnlockSession(keystore, password: password) {
+      let unlocked = try keystore.unlock(password: password)
 
-    if let eosKeystore = keystore as? EOSKeystore {
-      return eosKeystore.exportKeyPairs(password)
-    } else if let legacyEOSKeystore = keystore as? EOSLegacyKeystore {
-      return legacyEOSKeystore.exportPrivateKeys(password)
-    } else {
-      throw GenericError.operationUnsupported
+      if let eosKeystore = keystore as? EOSKeystore {
+        return eosKeystore.exportKeyPairs(unlocked)
+      } else if let legacyEOSKeystore = keystore as? EOSLegacyKeystore {
+        return legacyEOSKeystore.exportPrivateKeys(unlocked)
+      } else {
+        throw GenericError.operationUnsupported
+      }
     }
   }
 
@@ -134,20 +237,47 @@ public extension BasicWallet {
     return identity.removeWallet(self)
   }
 
+  /// - Returns: false if password is wrong, or the keystore can't be loaded.
   func verifyPassword(_ password: String) -> Bool {
-    return keystore.verify(password: password)
+    guard let keystore = try? loadKeystore() else {
+      return false
+    }
+    return withUnlockSession(keystore, password: password) {
+      keystore.verify(password: password)
+    }
+  }
+
+  /// Run body with the derived key of password served by `UnlockSessionCache` when it's enabled,
+  /// verifying and decrypting inside body then reuse it instead of running KDF again.
+  func withUnlockSession<T>(_ keystore: Keystore, password: String, _ body: () throws -> T) rethrows -> T {
+    guard UnlockSessionCache.isEnabled else {
+      return try body()
+    }
+
+    let crypto = keystore.crypto
+    let derivedKey = UnlockSessionCache.derivedKey(walletID: walletID, crypto: crypto, password: password)
+    return try crypto.withCachedDerivedKey(password: password, derivedKey: derivedKey, body)
   }
   
+  /// - Throws: GenericError.walletNotFound if the keystore can't be loaded.
+  public func derivedKey(password: String) throws -> String {
+    return try loadKeystore().crypto.derivedKey(with: password)
+  }
+
+  @available(*, deprecated, renamed: "derivedKey(password:)")
   public func derivedKeyBy(_ password: String) -> String {
-    return keystore.crypto.derivedKey(with: password)
+    guard let key = try? derivedKey(password: password) else {
+      preconditionFailure("Keystore of wallet \(walletID) is missing or invalid")
+    }
+    return key
   }
 
-  func serializeToMap() -> JSONObject {
-    return keystore.serializeToMap()
+  func serializeToMap() throws -> JSONObject {
+    return try loadKeystore().serializeToMap()
   }
 
   func calcExternalAddress(at externalIdx: Int) throws -> String {
-    guard let hdkeystore = self.keystore as? BTCMnemonicKeystore else {
+    guard let hdkeystore = try loadKeystore() as? BTCMnemonicKeystore else {
       throw GenericError.operationUnsupported
     }
 
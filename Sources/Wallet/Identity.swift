@@ -11,13 +11,18 @@ import CoreBitcoin
 
 public final class Identity {
   private static var _currentIdentity: Identity?
+  private static let currentIdentityLock = NSLock()
   static let storage = StorageManager.storage
 
   public static var currentIdentity: Identity? {
     set(newIdentity) {
+      currentIdentityLock.lock()
       _currentIdentity = newIdentity
+      currentIdentityLock.unlock()
     }
     get {
+      currentIdentityLock.lock()
+      defer { currentIdentityLock.unlock() }
       if _currentIdentity == nil {
         _currentIdentity = storage.tryLoadIdentity()
       }
@@ -25,35 +30,82 @@ public final class Identity {
     }
   }
 
-  public var keystore: IdentityKeystore
+  /// Snapshot of the identity keystore, taken under walletsLock.
+  public var keystore: IdentityKeystore {
+    return walletsLock.read { _keystore }
+  }
   public var identifier: String {
     return keystore.identifier
   }
   public var wallets: [BasicWallet] {
-    return keystore.wallets
+    return walletsLock.read { _keystore.wallets }
   }
 
+  private var _keystore: IdentityKeystore
+  /// Lookup indexes over keystore.wallets, maintained by append, removeWallet and replaceKeystore.
+  private var walletsByID = [WalletID: BasicWallet]()
+  private var walletsByAddress = [WalletAddressKey: BasicWallet]()
+  /// Guards the keystore, its wallets and their indexes. Lookups share it, changes to the wallet list take it exclusively.
+  private let walletsLock = ReadWriteLock()
+
   init(metadata: WalletMeta, mnemonic: String, password: String) throws {
-    keystore = try IdentityKeystore(metadata: metadata, mnemonic: mnemonic, password: password)
+    let seed = try MnemonicUtil.seed(from: mnemonic)
+
+    // Identity keystore and every wallet keystore run their own KDF, build them all concurrently from one seed.
+    // A nil chain type stands for the identity keystore.
+    let chainTypes: [ChainType?] = [nil, .eth, .btc]
+    var identityKeystore: IdentityKeystore?
+    let walletKeystores = try chainTypes.tk_concurrentMap { chainType -> Keystore? in
+      guard let chainType = chainType else {
+        identityKeystore = try IdentityKeystore(metadata: metadata, mnemonic: mnemonic, seed: seed, password: password)
+        return nil
+      }
+      return try Identity.deriveKeystore(for: chainType, mnemonic: mnemonic, seed: seed, password: password, identityMeta: metadata)
+    }
 
-    _ = try deriveWallets(for: [.eth, .btc], mnemonic: mnemonic, password: password)
+    _keystore = identityKeystore!
+    for walletKeystore in walletKeystores.compactMap({ $0 }) {
+      _ = try append(walletKeystore)
+    }
+
+    _ = Identity.storage.flushIdentity(_keystore)
+  }
 
-    _ = Identity.storage.flushIdentity(keystore)
+  public convenience init?(json: JSONObject) {
+    self.init(fields: .json(json))
   }
 
-  public init?(json: JSONObject) {
-    guard let keystore = try? IdentityKeystore(json: json) else {
+  /// Wallet IDs and index, when given, replace the stored ones, e.g. with changes logged since the identity was written.
+  init?(fields: KeystoreFields, walletIDs: [String]? = nil, walletIndex: [WalletSummary]? = nil) {
+    guard var keystore = try? IdentityKeystore(fields: fields) else {
       return nil
     }
-    self.keystore = keystore
-    self.keystore.wallets = Identity.storage.loadWalletByIDs(self.keystore.walletIds)
+    if let walletIDs = walletIDs {
+      keystore.walletIds = walletIDs
+    }
+    _keystore = keystore
+
+    // Keep only the wallet index in memory, parse keystores on first use.
+    // Identity saved without an index loads every keystore up front.
+    let index = walletIndex ?? fields.objects("walletIndex")?.compactMap { WalletSummary(fields: $0) } ?? []
+    if index.map({ $0.walletID }) == keystore.walletIds {
+      _keystore.wallets = index.map { summary in
+        BasicWallet(summary: summary) {
+          guard let wallet = Identity.storage.loadWalletByIDs([summary.walletID]).first else {
+            return nil
+          }
+          return try? wallet.loadKeystore()
+        }
+      }
+    } else {
+      _keystore.wallets = Identity.storage.loadWalletByIDs(keystore.walletIds)
+    }
+    _keystore.wallets.forEach { addToIndexes($0) }
   }
 
   public func export(password: String) throws -> String {
-    guard keystore.verify(password: password) else {
-      throw PasswordError.incorrect
-    }
-    return try keystore.mnemonic(from: password)
+    let keystore = self.keystore
+    return keystore.mnemonic(from: try keystore.unlock(password: password))
   }
 
   public func delete(password: String) throws -> Bool {
@@ -62,6 +114,7 @@ public final class Identity {
     }
 
     if Identity.storage.cleanStorage() {
+      UnlockSessionCache.lockAll()
       Identity.currentIdentity = nil
       return true
     }
@@ -95,27 +148,52 @@ public extension Identity {
 extension Identity {
   func append(_ newKeystore: Keystore) throws -> BasicWallet {
     let wallet = BasicWallet(newKeystore)
-    
-    if findWalletByAddress(wallet.address.removePrefix0xIfNeeded(), on: newKeystore.meta.chain!) != nil {
-      throw AddressError.alreadyExist
-    }
-    
-    keystore.wallets.append(wallet)
-    keystore.walletIds.append(wallet.walletID)
-    if Identity.storage.flushWallet(wallet.keystore) && Identity.storage.flushIdentity(keystore) {
-      return wallet
-    }
 
-    throw GenericError.importFailed
+    return try walletsLock.write {
+      if walletsByAddress[WalletAddressKey(wallet.address, on: newKeystore.meta.chain!)] != nil {
+        throw AddressError.alreadyExist
+      }
+
+      _keystore.wallets.append(wallet)
+      _keystore.walletIds.append(wallet.walletID)
+      addToIndexes(wallet)
+      if Identity.storage.flushWallet(newKeystore, identity: _keystore) {
+        return wallet
+      }
+
+      throw GenericError.importFailed
+    }
   }
 
   func removeWallet(_ wallet: BasicWallet) -> Bool {
-    if let index = keystore.walletIds.index(where: { return $0 == wallet.walletID }) {
-      keystore.wallets.remove(at: index)
-      keystore.walletIds.remove(at: index)
-      return Identity.storage.flushIdentity(keystore)
+    return walletsLock.write {
+      if let index = _keystore.walletIds.index(where: { return $0 == wallet.walletID }) {
+        UnlockSessionCache.lock(walletID: wallet.walletID)
+        let removed = _keystore.wallets.remove(at: index)
+        _keystore.walletIds.remove(at: index)
+        removeFromIndexes(removed)
+        return Identity.storage.removeWallet(wallet.walletID, identity: _keystore)
+      }
+      return false
+    }
+  }
+
+  /// Swap in a keystore whose address may differ from the current one, e.g. switching BTC address type
+  /// or setting EOS account name. Wallet and identity (whose wallet index keeps the address) are committed together.
+  func replaceKeystore(of wallet: BasicWallet, with newKeystore: Keystore) throws {
+    try walletsLock.write {
+      let key = WalletAddressKey(newKeystore.address, on: newKeystore.meta.chain!)
+      if let existing = walletsByAddress[key], existing !== wallet {
+        throw AddressError.alreadyExist
+      }
+
+      removeFromIndexes(wallet)
+      wallet.setKeystore(newKeystore)
+      addToIndexes(wallet)
+      if !Identity.storage.flushWallet(newKeystore, identity: _keystore) {
+        throw GenericError.storeWalletFailed
+      }
     }
-    return false
   }
 
   func importFromMnemonic(_ mnemonic: String, metadata: WalletMeta, encryptBy password: String, at path: String) throws -> BasicWallet {
@@ -182,11 +260,11 @@ extension Identity {
   func importFromKeystore(_ keystore: JSONObject, encryptedBy password: String, metadata: WalletMeta) throws -> BasicWallet {
     var keystore = try ETHKeystore(json: keystore)
     keystore.meta = metadata
-    guard keystore.verify(password: password) else {
+    guard let unlocked = try? keystore.unlock(password: password) else {
       throw KeystoreError.macUnmatch
     }
 
-    let privateKey = keystore.decryptPrivateKey(password)
+    let privateKey = keystore.decryptPrivateKey(unlocked)
     do {
     _ = try PrivateKeyValidator(privateKey, on: .eth).validate()
     } catch let err as AppError {
@@ -196,7 +274,7 @@ extension Identity {
         throw err
       }
     }
-    guard ETHKey(privateKey: keystore.decryptPrivateKey(password)).address == keystore.address else {
+    guard ETHKey(privateKey: privateKey)?.address == keystore.address else {
       throw KeystoreError.privateKeyAddressUnmatch
     }
 
@@ -224,8 +302,10 @@ extension Identity {
 
   func findWalletByPrivateKey(_ privateKey: String, on chainType: ChainType, network: Network? = nil, segWit: SegWit = .none) throws -> BasicWallet? {
     if chainType == .eth {
-      let address = ETHKey(privateKey: privateKey).address
-      return findWalletByAddress(address, on: chainType)
+      guard let key = ETHKey(privateKey: privateKey) else {
+        throw PrivateKeyError.invalid
+      }
+      return findWalletByAddress(key.address, on: chainType)
     } else {
       guard let key = BTCKey(wif: privateKey) else {
         throw PrivateKeyError.invalid
@@ -247,11 +327,7 @@ extension Identity {
       let addr = ETHKey.mnemonicToAddress(mnemonic, path: path)
       return findWalletByAddress(addr, on: chainType)
     } else if chainType == .btc {
-      guard let btcMnemonic = BTCMnemonic(words: mnemonic.split(separator: " "), password: "", wordListType: .english),
-        let seedData = btcMnemonic.seed else {
-          throw MnemonicError.wordInvalid
-      }
-
+      let seedData = try MnemonicUtil.seed(from: mnemonic)
       let isMainnet = network?.isMainnet ?? true
       guard let masterKeychain = BTCKeychain(seed: seedData, network: isMainnet ? BTCNetwork.mainnet() : BTCNetwork.testnet()),
         let account = masterKeychain.derivedKeychain(withPath: path),
@@ -277,33 +353,82 @@ extension Identity {
   }
 
   func findWalletByWalletID(_ walletID: String) -> BasicWallet? {
-    return keystore.wallets.first(where: { return $0.walletID == walletID })
+    return walletsLock.read { walletsByID[walletID] }
   }
 
   func findWalletByAddress(_ address: String, on chainType: ChainType) -> BasicWallet? {
-    return keystore.wallets.first { (wallet) -> Bool in
-      return wallet.address.removePrefix0xIfNeeded() == address.removePrefix0xIfNeeded() && wallet.imTokenMeta.chain == chainType
-    }
+    let key = WalletAddressKey(address, on: chainType)
+    return walletsLock.read { walletsByAddress[key] }
   }
 
   func deriveWallets(for chainTypes: [ChainType], mnemonic: String, password: String) throws -> [BasicWallet] {
-    return try chainTypes.map { chainType in
-      var meta = WalletMeta(chain: chainType, source: keystore.meta.source)
-      meta.passwordHint = keystore.meta.passwordHint
-
-      switch chainType {
-      case .eth:
-        meta.name = "ETH"
-        return try importFromMnemonic(mnemonic, metadata: meta, encryptBy: password, at: BIP44.eth)
-      case .btc:
-        meta.name = "BTC"
-        meta.network = keystore.meta.network
-        meta.segWit = keystore.meta.segWit
-        return try importFromMnemonic(mnemonic, metadata: meta, encryptBy: password, at: BIP44.path(for: meta.network, segWit: meta.segWit))
-      case .eos:
-        meta.name = "EOS"
-        return try importEOS(from: mnemonic, accountName: "", permissions: [], metadata: meta, encryptBy: password, at: BIP44.eosLedger)
-      }
+    let seed = try MnemonicUtil.seed(from: mnemonic)
+    let identityMeta = keystore.meta
+    let keystores = try chainTypes.tk_concurrentMap { chainType in
+      try Identity.deriveKeystore(for: chainType, mnemonic: mnemonic, seed: seed, password: password, identityMeta: identityMeta)
+    }
+    return try keystores.map { try append($0) }
+  }
+
+  /// Derive wallet keystore of the chain from identity mnemonic and its seed.
+  /// Touches no identity state, so keystores of several chains can be derived concurrently.
+  static func deriveKeystore(for chainType: ChainType, mnemonic: String, seed: Data, password: String, identityMeta: WalletMeta) throws -> Keystore {
+    var meta = WalletMeta(chain: chainType, source: identityMeta.source)
+    meta.passwordHint = identityMeta.passwordHint
+
+    switch chainType {
+    case .eth:
+      meta.name = "ETH"
+      return try ETHMnemonicKeystore(password: password, mnemonic: mnemonic, seed: seed, path: BIP44.eth, metadata: meta)
+    case .btc:
+      meta.name = "BTC"
+      meta.network = identityMeta.network
+      meta.segWit = identityMeta.segWit
+      return try BTCMnemonicKeystore(password: password, mnemonic: mnemonic, seed: seed, path: BIP44.path(for: meta.network, segWit: meta.segWit), metadata: meta)
+    case .eos:
+      meta.name = "EOS"
+      return try EOSKeystore(accountName: "", password: password, mnemonic: mnemonic, seed: seed, path: BIP44.eosLedger, permissions: [], metadata: meta)
+    }
+  }
+}
+
+// MARK: Wallet Indexes
+private extension Identity {
+  struct WalletAddressKey: Hashable {
+    let chainType: ChainType
+    let address: String
+
+    init(_ address: String, on chainType: ChainType) {
+      self.chainType = chainType
+      self.address = chainType.normalizedAddress(address)
+    }
+  }
+
+  func addressKey(of wallet: BasicWallet) -> WalletAddressKey? {
+    guard let chainType = wallet.chainType else {
+      return nil
+    }
+    return WalletAddressKey(wallet.address, on: chainType)
+  }
+
+  /// First wallet stays indexed when several share an address, as a linear scan would find it.
+  /// Only legacy storage holds such duplicates, append rejects them.
+  /// Callers hold walletsLock for writing, except init.
+  func addToIndexes(_ wallet: BasicWallet) {
+    if walletsByID[wallet.walletID] == nil {
+      walletsByID[wallet.walletID] = wallet
+    }
+    if let key = addressKey(of: wallet), walletsByAddress[key] == nil {
+      walletsByAddress[key] = wallet
+    }
+  }
+
+  func removeFromIndexes(_ wallet: BasicWallet) {
+    if walletsByID[wallet.walletID] === wallet {
+      walletsByID[wallet.walletID] = nil
+    }
+    if let key = addressKey(of: wallet), walletsByAddress[key] === wallet {
+      walletsByAddress[key] = _keystore.wallets.first { $0 !== wallet && addressKey(of: $0) == key }
     }
   }
 }
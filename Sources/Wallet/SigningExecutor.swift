@@ -0,0 +1,167 @@
+//
+//  SigningExecutor.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Runs KDF and signing work of the async WalletManager APIs on a bounded queue of its own,
+/// so callers' threads never block on scrypt.
+/// Higher priority tasks start first, pending tasks can be cancelled, and queue latency and execution time are tracked.
+/// Tasks run their CoreBitcoin signing concurrently, which OpenSSLThreading.c makes safe.
+public final class SigningExecutor {
+  public static let shared = SigningExecutor()
+
+  public enum Priority {
+    case low, normal, high
+
+    var queuePriority: Operation.QueuePriority {
+      switch self {
+      case .low:
+        return .low
+      case .normal:
+        return .normal
+      case .high:
+        return .high
+      }
+    }
+  }
+
+  public struct Metrics {
+    public internal(set) var completedCount = 0
+    public internal(set) var cancelledCount = 0
+    /// Seconds from submission until a task started running.
+    public internal(set) var totalQueueLatency: TimeInterval = 0
+    public internal(set) var maxQueueLatency: TimeInterval = 0
+    /// Seconds tasks spent running.
+    public internal(set) var totalExecutionTime: TimeInterval = 0
+    public internal(set) var maxExecutionTime: TimeInterval = 0
+
+    public var averageQueueLatency: TimeInterval {
+      return completedCount == 0 ? 0 : totalQueueLatency / Double(completedCount)
+    }
+
+    public var averageExecutionTime: TimeInterval {
+      return completedCount == 0 ? 0 : totalExecutionTime / Double(completedCount)
+    }
+  }
+
+  /// Tasks running at once, defaults to the number of active cores.
+  public var maxConcurrentTasks: Int {
+    get {
+      return queue.maxConcurrentOperationCount
+    }
+    set {
+      queue.maxConcurrentOperationCount = max(1, newValue)
+    }
+  }
+
+  public var metrics: Metrics {
+    metricsLock.lock()
+    defer { metricsLock.unlock() }
+    return currentMetrics
+  }
+
+  private let queue = OperationQueue()
+  private var currentMetrics = Metrics()
+  private let metricsLock = NSLock()
+
+  public init(maxConcurrentTasks: Int = ProcessInfo.processInfo.activeProcessorCount) {
+    queue.name = "org.consenlabs.imtoken.TokenCore.signing"
+    queue.qualityOfService = .userInitiated
+    self.maxConcurrentTasks = maxConcurrentTasks
+  }
+
+  public func resetMetrics() {
+    metricsLock.lock()
+    currentMetrics = Metrics()
+    metricsLock.unlock()
+  }
+
+  /// Run work on the executor and deliver its result, or error, on completionQueue.
+  /// A task cancelled before it finishes completes with GenericError.operationCancelled.
+  @discardableResult
+  public func submit<T>(
+    priority: Priority = .normal,
+    completionQueue: DispatchQueue = .main,
+    work: @escaping () throws -> T,
+    completion: @escaping (T?, Error?) -> Void
+  ) -> SigningTask {
+    let submittedAt = ProcessInfo.processInfo.systemUptime
+    let operation = BlockOperation()
+    operation.queuePriority = priority.queuePriority
+    var didRun = false
+    operation.addExecutionBlock { [unowned operation, weak self] in
+      guard !operation.isCancelled else {
+        return
+      }
+      didRun = true
+
+      let startedAt = ProcessInfo.processInfo.systemUptime
+      var result: T?
+      var error: Error?
+      do {
+        result = try work()
+      } catch let err {
+        error = err
+      }
+      self?.recordCompleted(queueLatency: startedAt - submittedAt, executionTime: ProcessInfo.processInfo.systemUptime - startedAt)
+
+      let isCancelled = operation.isCancelled
+      completionQueue.async {
+        if isCancelled {
+          completion(nil, GenericError.operationCancelled)
+        } else {
+          completion(result, error)
+        }
+      }
+    }
+    // Runs once the operation finishes, also when it's cancelled before starting and its block is skipped
+    operation.completionBlock = { [weak self] in
+      guard !didRun else {
+        return
+      }
+      self?.recordCancelled()
+      completionQueue.async { completion(nil, GenericError.operationCancelled) }
+    }
+    queue.addOperation(operation)
+    return SigningTask(operation: operation)
+  }
+
+  private func recordCompleted(queueLatency: TimeInterval, executionTime: TimeInterval) {
+    metricsLock.lock()
+    currentMetrics.completedCount += 1
+    currentMetrics.totalQueueLatency += queueLatency
+    currentMetrics.maxQueueLatency = max(currentMetrics.maxQueueLatency, queueLatency)
+    currentMetrics.totalExecutionTime += executionTime
+    currentMetrics.maxExecutionTime = max(currentMetrics.maxExecutionTime, executionTime)
+    metricsLock.unlock()
+  }
+
+  private func recordCancelled() {
+    metricsLock.lock()
+    currentMetrics.cancelledCount += 1
+    metricsLock.unlock()
+  }
+}
+
+/// Handle of work submitted to SigningExecutor.
+public final class SigningTask {
+  private let operation: Operation
+
+  init(operation: Operation) {
+    self.operation = operation
+  }
+
+  public var isCancelled: Bool {
+    return operation.isCancelled
+  }
+
+  /// Cancel the task. Work already running is not interrupted, but its result is dropped.
+  public func cancel() {
+    operation.cancel()
+  }
+}
@@ -0,0 +1,105 @@
+//
+//  WalletManager+Async.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// Async variants of the APIs running KDF. Work runs on `SigningExecutor.shared`,
+/// completion is called on main queue with either the result or the error the sync API throws.
+public extension WalletManager {
+  @discardableResult
+  public static func exportPrivateKey(
+    walletID: String,
+    password: String,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping (String?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try exportPrivateKey(walletID: walletID, password: password)
+    }, completion: completion)
+  }
+
+  @discardableResult
+  public static func ethSignTransaction(
+    walletID: String,
+    nonce: String,
+    gasPrice: String,
+    gasLimit: String,
+    to: String,
+    value: String,
+    data: String,
+    password: String,
+    chainID: Int,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping (TransactionSignedResult?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try ethSignTransaction(walletID: walletID, nonce: nonce, gasPrice: gasPrice, gasLimit: gasLimit, to: to, value: value, data: data, password: password, chainID: chainID)
+    }, completion: completion)
+  }
+
+  @discardableResult
+  public static func ethSignTransactions(
+    walletID: String,
+    transactions: [[String: String]],
+    password: String,
+    chainID: Int,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping ([TransactionSignedResult]?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try ethSignTransactions(walletID: walletID, transactions: transactions, password: password, chainID: chainID)
+    }, completion: completion)
+  }
+
+  @discardableResult
+  public static func btcSignTransaction(
+    walletID: String,
+    to: String,
+    amount: Int64,
+    fee: Int64,
+    password: String,
+    outputs: [[String: Any]],
+    changeIdx: Int,
+    isTestnet: Bool,
+    segWit: SegWit,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping (TransactionSignedResult?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try btcSignTransaction(walletID: walletID, to: to, amount: amount, fee: fee, password: password, outputs: outputs, changeIdx: changeIdx, isTestnet: isTestnet, segWit: segWit)
+    }, completion: completion)
+  }
+
+  @discardableResult
+  public static func eosSignTransaction(
+    walletID: String,
+    txs: [EOSTransaction],
+    password: String,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping ([EOSSignResult]?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try eosSignTransaction(walletID: walletID, txs: txs, password: password)
+    }, completion: completion)
+  }
+
+  @discardableResult
+  public static func eosEcSign(
+    walletID: String,
+    data: String,
+    isHex: Bool,
+    publicKey: String?,
+    password: String,
+    priority: SigningExecutor.Priority = .normal,
+    completion: @escaping (String?, Error?) -> Void
+  ) -> SigningTask {
+    return SigningExecutor.shared.submit(priority: priority, work: {
+      try eosEcSign(walletID: walletID, data: data, isHex: isHex, publicKey: publicKey, password: password)
+    }, completion: completion)
+  }
+}
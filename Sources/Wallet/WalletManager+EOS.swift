@@ -39,17 +39,17 @@ public extension WalletManager {
       throw GenericError.operationUnsupported
     }
 
-    guard var keystore = wallet.keystore as? EOSKeystore else {
-      throw GenericError.operationUnsupported
-    }
+    return try wallet.withMutationLock {
+      guard var keystore = try wallet.loadKeystore() as? EOSKeystore else {
+        throw GenericError.operationUnsupported
+      }
 
-    try keystore.setAccountName(accountName)
-    wallet.keystore = keystore
-    if !Identity.storage.flushWallet(keystore) {
-      throw GenericError.storeWalletFailed
-    }
+      try keystore.setAccountName(accountName)
+      let identity = try IdentityValidator().validate()
+      try identity.replaceKeystore(of: wallet, with: keystore)
 
-    return wallet
+      return wallet
+    }
   }
 
   public static func exportPrivateKeys(walletID: String, password: String) throws -> [KeyPair] {
@@ -74,7 +74,10 @@ public extension WalletManager {
       throw GenericError.walletNotFound
     }
 
-    return try EOSTransactionSigner(txs: txs, keystore: wallet.keystore, password: password).sign()
+    let keystore = try wallet.loadKeystore()
+    return try wallet.withUnlockSession(keystore, password: password) {
+      try EOSTransactionSigner(txs: txs, keystore: keystore, password: password).sign()
+    }
   }
   
   public static func eosEcSign(walletID: String, data: String, isHex: Bool, publicKey: String?, password: String) throws -> String {
@@ -82,12 +85,15 @@ public extension WalletManager {
       throw GenericError.walletNotFound
     }
     
+    let keystore = try wallet.loadKeystore()
     let eosKey: EOSKey
-    if wallet.keystore is  EOSLegacyKeystore {
+    if keystore is  EOSLegacyKeystore {
       let wif = try wallet.privateKey(password: password)
       eosKey = EOSKey(wif: wif)
-    } else if wallet.keystore is EOSKeystore {
-      let prvKey = try (wallet.keystore as! EOSKeystore).decryptPrivateKey(from: publicKey!, password: password)
+    } else if let eosKeystore = keystore as? EOSKeystore {
+      let prvKey = try wallet.withUnlockSession(keystore, password: password) {
+        try eosKeystore.decryptPrivateKey(from: publicKey!, password: password)
+      }
       eosKey = EOSKey(privateKey: prvKey)
     } else {
       throw "Only EOS wallet can invoke the eosEcSign"
@@ -109,5 +115,18 @@ public extension WalletManager {
     
     return try EOSKey.ecRecover(data: hashedData, signature: sig)
   }
+
+  /// Recover public keys of many signatures at once, nil for each signature that fails to recover.
+  public static func eosEcRecover(data: [String], isHex: Bool, signatures: [String]) throws -> [String?] {
+    let hashes = try data.map { item -> Data in
+      guard let hashedData = (isHex ? item.tk_dataFromHexString() : item.data(using: .utf8)?.sha256()) else {
+        throw "Data shoud be string or hex"
+      }
+      return hashedData
+    }
+    let sigs = try signatures.map { try EOSTransaction.deserializeSignature(sig: $0) }
+
+    return try EOSKey.batchEcRecover(hashes: hashes, signatures: sigs)
+  }
   
 }
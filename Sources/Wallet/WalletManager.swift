@@ -89,11 +89,12 @@ public struct WalletManager {
       throw GenericError.walletNotFound
     }
 
+    let exported = try wallet.export()
     guard wallet.verifyPassword(password) else {
       throw PasswordError.incorrect
     }
 
-    return wallet.export()
+    return exported
   }
 
   /**
@@ -132,6 +133,27 @@ public struct WalletManager {
     return tx.signedResult
   }
 
+  /**
+   Sign many transactions of one wallet, decrypting the private key only once.
+
+   - parameter transactions: Raw transactions, each with nonce, gasPrice, gasLimit, to, value and data.
+   - returns signed results in the same order as transactions
+   */
+  public static func ethSignTransactions(
+    walletID: String,
+    transactions: [[String: String]],
+    password: String,
+    chainID: Int
+  ) throws -> [TransactionSignedResult] {
+    guard let wallet = Identity.currentIdentity?.findWalletByWalletID(walletID) else {
+      throw GenericError.walletNotFound
+    }
+
+    let privateKey = try wallet.privateKey(password: password)
+    let txs = transactions.map { ETHTransaction(raw: $0, chainID: chainID) }
+    return ETHTransaction.sign(txs, with: privateKey)
+  }
+
   public static func btcSignTransaction(
     walletID: String,
     to: String,
@@ -154,17 +176,7 @@ public struct WalletManager {
     var unspents = [UTXO]()
     var unspentAmount:Int64 = 0
     for output in outputs {
-      let utxo: UTXO?
-      // result form api.blockchain.info contains 'tx_hash_big_endian'
-      if output["tx_hash_big_endian"] != nil {
-        utxo = UTXO.parseFormBlockchain(output, isTestNet: isTestnet, isSegWit: segWit.isSegWit)
-      } else {
-        utxo = UTXO(raw: output)
-      }
-      guard let unspent = utxo else {
-        throw GenericError.paramError
-      }
-      
+      let unspent = try parseUnspent(output, isTestnet: isTestnet, segWit: segWit)
       unspents.append(unspent)
       unspentAmount += unspent.amount
       
@@ -173,30 +185,77 @@ public struct WalletManager {
       }
     }
 
+    return try btcSignTransaction(wallet: wallet, toAddress: toAddress, amount: amount, fee: fee, password: password, unspents: unspents, changeIdx: changeIdx, isTestnet: isTestnet, segWit: segWit)
+  }
+
+  /// Sign a BTC transaction whose inputs and fee are picked by coin selection rather than in the order of outputs.
+  /// - Parameter feeRate: Satoshis per virtual byte.
+  public static func btcSignTransaction(
+    walletID: String,
+    to: String,
+    amount: Int64,
+    feeRate: Int64,
+    password: String,
+    outputs: [[String: Any]],
+    changeIdx: Int,
+    isTestnet: Bool,
+    segWit: SegWit,
+    strategy: CoinSelectionStrategy = .branchAndBound
+  ) throws -> TransactionSignedResult {
+    guard let wallet = Identity.currentIdentity?.findWalletByWalletID(walletID) else {
+      throw GenericError.walletNotFound
+    }
+
+    guard let toAddress = BTCAddress(string: to), let paymentScript = BTCScript(address: toAddress) else {
+      throw AddressError.invalid
+    }
+
+    let unspents = try outputs.map { try parseUnspent($0, isTestnet: isTestnet, segWit: segWit) }
+    let selector = CoinSelector(feeRate: feeRate, isSegWit: segWit.isSegWit, paymentScriptLength: paymentScript.data.count)
+    let selection = try selector.select(from: unspents, amount: amount, strategy: strategy)
+
+    return try btcSignTransaction(wallet: wallet, toAddress: toAddress, amount: amount, fee: selection.fee, password: password, unspents: selection.utxos, changeIdx: changeIdx, isTestnet: isTestnet, segWit: segWit)
+  }
+
+  private static func parseUnspent(_ output: [String: Any], isTestnet: Bool, segWit: SegWit) throws -> UTXO {
+    let utxo: UTXO?
+    // result form api.blockchain.info contains 'tx_hash_big_endian'
+    if output["tx_hash_big_endian"] != nil {
+      utxo = UTXO.parseFormBlockchain(output, isTestNet: isTestnet, isSegWit: segWit.isSegWit)
+    } else {
+      utxo = UTXO(raw: output)
+    }
+    guard let unspent = utxo else {
+      throw GenericError.paramError
+    }
+    return unspent
+  }
+
+  private static func btcSignTransaction(
+    wallet: BasicWallet,
+    toAddress: BTCAddress,
+    amount: Int64,
+    fee: Int64,
+    password: String,
+    unspents: [UTXO],
+    changeIdx: Int,
+    isTestnet: Bool,
+    segWit: SegWit
+  ) throws -> TransactionSignedResult {
     let changeKey: BTCKey
     let privateKeys: [BTCKey]
 
     if wallet.imTokenMeta.source == .wif {
       let wif = try wallet.privateKey(password: password)
       changeKey = BTCKey(wif: wif)
-      privateKeys = Array(repeating: changeKey, count: outputs.count)
+      privateKeys = Array(repeating: changeKey, count: unspents.count)
     } else {
       let extendedKey = try wallet.privateKey(password: password)
       guard let keychain = BTCKeychain(extendedKey: extendedKey), let key = keychain.changeKey(at: UInt32(changeIdx)) else {
           throw GenericError.unknownError
       }
       changeKey = key
-      privateKeys = unspents.map { output in
-        let key: BTCKey
-        if let derivedPath = output.derivedPath {
-          let pathWithSlash = "/\(derivedPath)"
-          key = keychain.key(withPath: pathWithSlash)!
-        } else {
-          key = BTCMnemonicKeystore.findUtxoKeyByScript(output.scriptPubKey, at: keychain, isSegWit: segWit.isSegWit)!
-        }
-        key.isPublicKeyCompressed = true
-        return key
-      }
+      privateKeys = try UTXOKeyDeriver(keychain: keychain, isSegWit: segWit.isSegWit).keys(for: unspents)
     }
 
     let changeAddress = changeKey.address(on: isTestnet ? .testnet : .mainnet, segWit: segWit)
@@ -218,49 +277,44 @@ public struct WalletManager {
       throw GenericError.operationUnsupported
     }
 
-    if wallet.imTokenMeta.segWit == segWit {
-      return wallet
-    }
-
-    let newKeystore: Keystore
-    var metadata = wallet.imTokenMeta
-    metadata.segWit = segWit
-    let path = BIP44.path(for: metadata.network, segWit: segWit)
+    // Derive the new keystore from the current one and swap it in without another change in between
+    return try wallet.withMutationLock {
+      if wallet.imTokenMeta.segWit == segWit {
+        return wallet
+      }
 
-    if let mnemonicKeystore = wallet.keystore as? EncMnemonicKeystore {
-      guard wallet.keystore.verify(password: password) else {
-        throw PasswordError.incorrect
+      let newKeystore: Keystore
+      var metadata = wallet.imTokenMeta
+      metadata.segWit = segWit
+      let path = BIP44.path(for: metadata.network, segWit: segWit)
+
+      let keystore = try wallet.loadKeystore()
+      if let mnemonicKeystore = keystore as? EncMnemonicKeystore {
+        let mnemonic = mnemonicKeystore.decryptMnemonic(try keystore.unlock(password: password))
+
+        newKeystore = try BTCMnemonicKeystore(
+          password: password,
+          mnemonic: mnemonic,
+          path: path,
+          metadata: metadata,
+          id: walletID
+        )
+      } else {
+        // private key export already verifies password
+        let privateKey = try wallet.privateKey(password: password)
+        newKeystore = try BTCKeystore(
+          password: password,
+          wif: privateKey,
+          metadata: metadata,
+          id: walletID
+        )
       }
-      let mnemonic = mnemonicKeystore.decryptMnemonic(password)
-
-      newKeystore = try BTCMnemonicKeystore(
-        password: password,
-        mnemonic: mnemonic,
-        path: path,
-        metadata: metadata,
-        id: walletID
-      )
-    } else {
-      // private key export already verifies password
-      let privateKey = try wallet.privateKey(password: password)
-      newKeystore = try BTCKeystore(
-        password: password,
-        wif: privateKey,
-        metadata: metadata,
-        id: walletID
-      )
-    }
-    // check if the new walle will override the wallet derived by identity
-    if Identity.currentIdentity?.findWalletByAddress(newKeystore.address, on: .btc) != nil {
-      throw AddressError.alreadyExist
-    }
+      // throws if the new wallet will override the wallet derived by identity
+      let identity = try IdentityValidator().validate()
+      try identity.replaceKeystore(of: wallet, with: newKeystore)
 
-    wallet.keystore = newKeystore
-    if !Identity.storage.flushWallet(newKeystore) {
-      throw GenericError.storeWalletFailed
+      return wallet
     }
-
-    return wallet
   }
   
 
@@ -0,0 +1,54 @@
+//
+//  WalletSummary.swift
+//  TokenCore
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import Foundation
+
+/// What identity keeps of a wallet until its keystore is needed: ID, address and metadata.
+/// Stored in identity JSON as the wallet index, so loading identity doesn't parse every keystore.
+public struct WalletSummary {
+  public let walletID: WalletID
+  public let chainType: ChainType
+  public let address: String
+  public let meta: WalletMeta
+
+  init?(_ keystore: Keystore) {
+    guard let chainType = keystore.meta.chain else {
+      return nil
+    }
+    walletID = keystore.id
+    self.chainType = chainType
+    address = keystore.address
+    meta = keystore.meta
+  }
+
+  init?(fields: KeystoreFields) {
+    guard
+      let walletID = fields.string("id"),
+      let address = fields.string("address"),
+      let metaFields = fields.object(WalletMeta.key)
+    else {
+      return nil
+    }
+    let meta = WalletMeta(fields: metaFields)
+    guard let chainType = meta.chain else {
+      return nil
+    }
+    self.walletID = walletID
+    self.chainType = chainType
+    self.address = address
+    self.meta = meta
+  }
+
+  func toJSON() -> JSONObject {
+    return [
+      "id": walletID,
+      "address": address,
+      WalletMeta.key: meta.toJSON()
+    ]
+  }
+}
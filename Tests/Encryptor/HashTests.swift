@@ -7,6 +7,7 @@
 //
 
 import XCTest
+import CoreBitcoin
 @testable import TokenCore
 
 class HashTests: XCTestCase {
@@ -17,6 +18,11 @@ class HashTests: XCTestCase {
     XCTAssertEqual("734cc62f32841568f45715aeb9f4d7891324e6d948e4c6c60c0621cdac48623a", hash)
   }
 
+  func testSHA512() {
+    XCTAssertEqual("cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e", Hex.hex(from: Encryptor.SHA512.hash([])))
+    XCTAssertEqual("ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f", Hex.hex(from: Encryptor.SHA512.hash(Array("abc".utf8))))
+  }
+
   func testMerkleRoot() {
     
     let cases = [
@@ -37,4 +43,68 @@ class HashTests: XCTestCase {
       XCTAssertEqual(testCase[1], hash)
     }
   }
+
+  func testRIPEMD160() {
+    let messages = ["", "abc", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", String(repeating: "1234567890", count: 8)].map { Array($0.utf8) }
+    let data = Array(messages.joined())
+    let offsets = messages.reduce([0]) { $0 + [$0.last! + $1.count] }
+    var digests = [UInt8](repeating: 0, count: messages.count * 20)
+    tk_ripemd160_many(data, offsets, messages.count, &digests)
+
+    XCTAssertEqual("9c1185a5c5e9fc54612808977ee8f548b2258d31", Hex.hex(from: Array(digests[0..<20])))
+    XCTAssertEqual("8eb208f7e05d987a9b044a8e98c6b087f15a0bfc", Hex.hex(from: Array(digests[20..<40])))
+    XCTAssertEqual("12a053384a9c0c88e405a06c27dcf49ada62eb2b", Hex.hex(from: Array(digests[40..<60])))
+    XCTAssertEqual("9b752e45573d4b39f4dbd3323cab82bf63326bfb", Hex.hex(from: Array(digests[60..<80])))
+  }
+
+  func testHash160() {
+    let publicKey = "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798".tk_dataFromHexString()!
+    XCTAssertEqual("751e76e8199196d454941c45d1b3a323f1433bd6", Encryptor.Hash.hash160(publicKey).tk_toHexString())
+  }
+
+  func testBatchHashesMatchCoreBitcoin() {
+    // Lengths around the block size and its padding boundary
+    let messages = (0..<200).map { i in Data(bytes: (0..<i).map { UInt8(truncatingIfNeeded: $0 * 31 + i) }) }
+
+    var hash160s = [UInt8](repeating: 0, count: messages.count * 20)
+    Encryptor.Hash.batchHash160(messages, output: &hash160s)
+    var sha256ds = [UInt8](repeating: 0, count: messages.count * 32)
+    Encryptor.Hash.batchSHA256d(messages, output: &sha256ds)
+
+    for (i, message) in messages.enumerated() {
+      XCTAssertEqual(BTCHash160(message) as Data, Data(bytes: hash160s[(i * 20)..<((i + 1) * 20)]))
+      XCTAssertEqual(BTCHash256(message) as Data, Data(bytes: sha256ds[(i * 32)..<((i + 1) * 32)]))
+    }
+  }
+
+  func testPerformanceBatchHash160() {
+    let publicKeys = compressedPublicKeys
+    var output = [UInt8](repeating: 0, count: publicKeys.count * 20)
+    measure {
+      Encryptor.Hash.batchHash160(publicKeys, output: &output)
+    }
+  }
+
+  /// Same thread as testPerformanceBTCHash160, so the two compare the multi-buffer kernels to CommonCrypto and OpenSSL.
+  func testPerformanceBatchHash160Serial() {
+    let publicKeys = compressedPublicKeys
+    var output = [UInt8](repeating: 0, count: publicKeys.count * 20)
+    measure {
+      Encryptor.Hash.batchHash160(publicKeys, output: &output, concurrently: false)
+    }
+  }
+
+  /// CoreBitcoin's Hash160, CommonCrypto SHA-256 then OpenSSL RIPEMD-160, the baseline of batchHash160.
+  func testPerformanceBTCHash160() {
+    let publicKeys = compressedPublicKeys
+    measure {
+      for publicKey in publicKeys {
+        _ = BTCHash160(publicKey)
+      }
+    }
+  }
+
+  private var compressedPublicKeys: [Data] {
+    return (0..<10_000).map { i in Data(bytes: [0x02] + (0..<32).map { UInt8(truncatingIfNeeded: $0 &+ i) }) }
+  }
 }
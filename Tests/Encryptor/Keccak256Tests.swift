@@ -24,4 +24,16 @@ class Keccak256Tests: XCTestCase {
     let encrypted = Encryptor.Keccak256().encrypt(hex: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1")
     XCTAssertEqual("82ff40c0a986c6a5cfad4ddf4c3aa6996f1a7837f9c398e17e5de5cbd5a12b28", encrypted)
   }
+
+  func testKeccak256AroundBlockBoundary() {
+    let expected = [
+      135: "34367dc248bbd832f4e3e69dfaac2f92638bd0bbd18f2912ba4ef454919cf446",
+      136: "a6c4d403279fe3e0af03729caada8374b5ca54d8065329a3ebcaeb4b60aa386e",
+      137: "d869f639c7046b4929fc92a4d988a8b22c55fbadb802c0c66ebcd484f1915f39",
+      272: "cf7fcd4f705ee749930d19ca84561a9bf62516bd90a471545fa2f49fdc7e63c8"
+    ]
+    for (length, hash) in expected {
+      XCTAssertEqual(hash, Encryptor.Keccak256().encrypt(data: Data(repeating: 0x61, count: length)))
+    }
+  }
 }
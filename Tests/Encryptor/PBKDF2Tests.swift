@@ -28,4 +28,32 @@ class PBKDF2Tests: XCTestCase {
       XCTAssertEqual(expected, pbkdf2.encrypt())
     }
   }
+
+  func testHmacSHA512() {
+    let examples: [(String, String, Int, Int, String)] = [
+      /// password, salt, iterations, key len, expected
+      ("password", "salt", 1, 64, "867f70cf1ade02cff3752599a3a53dc4af34c7a669815ae5d513554e1c8cf252c02d470a285a0501bad999bfe943c08f050235d7d68b1da55e63f73b60a57fce"),
+      ("password", "salt", 2, 64, "e1d9c16aa681708a45f5c7c4e215ceb66e011a2e9f0040713f18aefdb866d53cf76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e"),
+      ("passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 64, "8c0511f4c6e597c6ac6315d8f0362e225f3c501495ba23b868c005174dc4ee71115b59f9e60cd9532fa33e0f75aefe30225c583a186cd82bd4daea9724a3d3b8"),
+      /// Password longer than a block, key longer than a digest
+      (String(repeating: "x", count: 200), "salt", 3, 80, "7e06f7557aae6057f38260ec33f67b9675bebccb8b17931386629a07d32149d2378b0cb294a152173818b94281c3db47d169e538b02deb3f2457884f1a3e04d9bb1483b5d4b099a9cd7dc62ecd1571c5"),
+      (TestData.mnemonic, "mnemonic", 2048, 64, TestData.seed)
+    ]
+
+    examples.forEach { password, salt, iterations, keyLength, expected in
+      let derivedKey = Encryptor.PBKDF2.hmacSHA512(password: Array(password.utf8), salt: Array(salt.utf8), iterations: iterations, keyLength: keyLength)
+      XCTAssertEqual(expected, Hex.hex(from: derivedKey))
+    }
+  }
+
+  func testPerformanceBIP39Seed() {
+    let password = Array(TestData.mnemonic.utf8)
+    let salt = Array("mnemonic".utf8)
+    measure {
+      /// 2048 iterations per seed, seeds per second = 10 / measured time.
+      for _ in 0..<10 {
+        _ = Encryptor.PBKDF2.hmacSHA512(password: password, salt: salt, iterations: ETHMnemonic.seedIterations)
+      }
+    }
+  }
 }
@@ -49,4 +49,20 @@ class Secp256k1Tests: XCTestCase {
     let invalidKey = "2d743dda0caabdfb9fca0034d33cd0da7fb1ffe78cb80d643d67bf3f2aa12810" // Last digit is wrong
     XCTAssert(encryptor.verify(key: invalidKey))
   }
+
+  func testRecoverPacked() {
+    let hash = Hex.toBytes("2a336702a8fbb5ad1af9243f17ab8a8ea6f4f15386ab84dd1357a6914867948b")
+    let signature = Hex.toBytes("07df15f290ac1433a71e8711936a9c1c481a613c4727d694e8065f26b9128e4a542dbd95801e656bddc992700842a71d73d8d208bb8bedf3a1afee82deba83bf")
+    let recoverer = Encryptor.Secp256k1.Recoverer()
+
+    let uncompressed = recoverer.recoverPacked(hashes: hash + hash, signatures: signature + signature, recids: [0, 4])!
+    XCTAssertEqual("042eb11b2eeb0db1d3c9ae8cd6cf71478bd415eff91b60869ee4b3a10a2e2f83c60dccab3a45c89fd0eb240e20cf089215c4779f0b35237d06cbced3fbab876e76", Hex.hex(from: Array(uncompressed[0..<65])))
+    // Invalid recid leaves its key zero filled
+    XCTAssertEqual([UInt8](repeating: 0, count: 65), Array(uncompressed[65..<130]))
+
+    let compressed = recoverer.recoverPacked(hashes: hash, signatures: signature, recids: [0], compressed: true)!
+    XCTAssertEqual("022eb11b2eeb0db1d3c9ae8cd6cf71478bd415eff91b60869ee4b3a10a2e2f83c6", Hex.hex(from: compressed))
+
+    XCTAssertNil(recoverer.recoverPacked(hashes: hash, signatures: signature, recids: [0, 1]))
+  }
 }
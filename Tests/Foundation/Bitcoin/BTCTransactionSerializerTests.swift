@@ -0,0 +1,80 @@
+//
+//  BTCTransactionSerializerTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+import CoreBitcoin
+@testable import TokenCore
+
+class BTCTransactionSerializerTests: XCTestCase {
+  private let utxos = [
+    [
+      "txHash": "c2ceb5088cf39b677705526065667a3992c68cc18593a9af12607e057672717f",
+      "vout": 0,
+      "amount": "50000",
+      "address": "2MwN441dq8qudMvtM5eLVwC3u4zfKuGSQAB",
+      "scriptPubKey": "a9142d2b1ef5ee4cf6c3ebc8cf66a602783798f7875987"
+    ],
+    [
+      "txHash": "9ad628d450952a575af59f7d416c9bc337d184024608f1d2e13383c44bd5cd74",
+      "vout": 0,
+      "amount": "50000",
+      "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN",
+      "scriptPubKey": "a91481af6d803fdc6dca1f3a1d03f5ffe8124cd1b44787"
+    ]
+  ].map { UTXO(raw: $0)! }
+
+  func testLegacyMatchesCoreBitcoin() {
+    let tx = try! signedTransaction(isSegWit: false)
+    let serializer = BTCTransactionSerializer(transaction: tx)
+    XCTAssertEqual(tx.hex, serializer.hex)
+    XCTAssertEqual(tx.transactionID, serializer.txID)
+    XCTAssertEqual(serializer.txID, serializer.witnessTxID)
+  }
+
+  func testSegWitMatchesCoreBitcoin() {
+    let tx = try! signedTransaction(isSegWit: true)
+    let serializer = BTCTransactionSerializer(transaction: tx)
+    XCTAssertEqual(tx.hexWithWitness, serializer.hex)
+    XCTAssertEqual(tx.transactionID, serializer.txID)
+    XCTAssertEqual(tx.witnessTransactionID, serializer.witnessTxID)
+    XCTAssertNotEqual(serializer.txID, serializer.witnessTxID)
+  }
+
+  func testUnsignedTransaction() {
+    let tx = BTCTransaction()
+    tx.addInputs(from: utxos)
+    let serializer = BTCTransactionSerializer(transaction: tx)
+    XCTAssertEqual(tx.hex, serializer.hex)
+    XCTAssertEqual(tx.transactionID, serializer.txID)
+  }
+
+  func testPerformanceSerialize() {
+    let tx = try! signedTransaction(isSegWit: true)
+    measure {
+      for _ in 0..<1000 {
+        let serializer = BTCTransactionSerializer(transaction: tx)
+        _ = serializer.hex
+        _ = serializer.txID
+        _ = serializer.witnessTxID
+      }
+    }
+  }
+
+  private func signedTransaction(isSegWit: Bool) throws -> BTCTransaction {
+    let key = BTCKey(privateKey: "a392604efc2fad9c0b3da43b5f698a2e3f270f170d859912be0d54742275c5f6".tk_dataFromHexString())!
+    key.isPublicKeyCompressed = true
+
+    let tx = BTCTransaction()
+    tx.version = isSegWit ? 2 : 1
+    tx.addInputs(from: utxos, isSegWit: isSegWit)
+    tx.addOutput(BTCTransactionOutput(value: 80000, address: BTCAddress(string: "2N9wBy6f1KTUF5h2UUeqRdKnBT6oSMh4Whp")))
+    tx.addOutput(BTCTransactionOutput(value: 10000, address: key.addressTestnet))
+    try tx.sign(with: [key, key], isSegWit: isSegWit)
+    return tx
+  }
+}
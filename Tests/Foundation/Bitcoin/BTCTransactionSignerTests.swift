@@ -300,6 +300,38 @@ class BTCTransactionSignerTests: TestCase {
       XCTFail("\(error)")
     }
   }
-  
-  
+
+  func testSignSegWitTransactionWithFeeRate() {
+    let identity = Identity.currentIdentity!
+    let metadata = WalletMeta(chain: .btc, source: .mnemonic, network: .testnet)
+    let wallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.btcSegwitTestnet)
+
+    let outputs: [[String: Any]] = [
+      [
+        "txHash": "c2ceb5088cf39b677705526065667a3992c68cc18593a9af12607e057672717f",
+        "vout": 0,
+        "amount": "50000",
+        "address": "2MwN441dq8qudMvtM5eLVwC3u4zfKuGSQAB",
+        "scriptPubKey": "a9142d2b1ef5ee4cf6c3ebc8cf66a602783798f7875987",
+        "derivedPath": "0/0"
+      ],
+      [
+        "txHash": "9ad628d450952a575af59f7d416c9bc337d184024608f1d2e13383c44bd5cd74",
+        "vout": 0,
+        "amount": "50000",
+        "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN",
+        "scriptPubKey": "a91481af6d803fdc6dca1f3a1d03f5ffe8124cd1b44787",
+        "derivedPath": "0/1"
+      ]
+    ]
+
+    let signedResult = try! WalletManager.btcSignTransaction(walletID: wallet.walletID, to: "2N9wBy6f1KTUF5h2UUeqRdKnBT6oSMh4Whp", amount: 80000, feeRate: 10, password: TestData.password, outputs: outputs, changeIdx: 0, isTestnet: true, segWit: .p2wpkh)
+    // Both inputs and a change output weigh 40 + 2 + 2 * 364 + 2 * 128 = 1026, 2570 satoshis fee for 257 vbytes leaves 17430 change
+    let expected = "020000000001027f717276057e6012afa99385c18cc692397a666560520577679bf38c08b5cec20000000017160014654fbb08267f3d50d715a8f1abb55979b160dd5bffffffff74cdd54bc48333e1d2f108460284d137c39b6c417d9ff55a572a9550d428d69a00000000171600149d66aa6399de69d5c5ae19f9098047760251a854ffffffff02803801000000000017a914b710f6e5049eaf0404c2f02f091dd5bb79fa135e87164400000000000017a914755fba51b5c443b9f16b1f86665dec10dd7a25c58702483045022100ee6b64ad32f860ed9bcc334ad8ea8d55e2589e2223bd0e52bc326b32540b8a8802202db33457f7d97e3554f10d6691e57666c297546155828fab6c0a6c1586eed66f0121031aee5e20399d68cf0035d1a21564868f22bc448ab205292b4279136b15ecaebc024730440220287255cebb517fdfdee8818bd170a4aa2018c79e4d8a6e4c28540ae5682c35f202204fb0051513b07160c91aa70ea22d83446a3b202b6b3c752e914c6d8892b09026012103a241c8d13dd5c92475652c43bf56580fbf9f1e8bc0aa0132ddc8443c03062bb900000000"
+    XCTAssertEqual(expected, signedResult.signedTx)
+    XCTAssertEqual("1a06832d4f9d60f6f2764408a00906da3e7ed34e4c221075a815f37156e8fc9d", signedResult.txHash)
+    XCTAssertEqual("d7da24358d807e9177d42be542983e0c561ce2f1980f1d3d27de37de9f354e69", signedResult.wtxID)
+
+    XCTAssertThrowsError(try WalletManager.btcSignTransaction(walletID: wallet.walletID, to: "2N9wBy6f1KTUF5h2UUeqRdKnBT6oSMh4Whp", amount: 80000, feeRate: 100, password: TestData.password, outputs: outputs, changeIdx: 0, isTestnet: true, segWit: .p2wpkh))
+  }
 }
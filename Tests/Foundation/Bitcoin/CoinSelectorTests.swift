@@ -0,0 +1,111 @@
+//
+//  CoinSelectorTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class CoinSelectorTests: XCTestCase {
+  private let legacy = CoinSelector(feeRate: 10, isSegWit: false)
+  private let segWit = CoinSelector(feeRate: 10, isSegWit: true)
+
+  func testInputVirtualSize() {
+    XCTAssertEqual(148, (CoinSelector.Weight.p2pkhInput + 3) / 4)
+    XCTAssertEqual(91, (CoinSelector.Weight.p2shP2wpkhInput + 3) / 4)
+    XCTAssertEqual(34, CoinSelector.Weight.output(scriptLength: 25) / 4)
+    XCTAssertEqual(1480, legacy.fee(weight: legacy.inputWeight))
+    XCTAssertEqual(910, segWit.fee(weight: segWit.inputWeight))
+  }
+
+  func testBranchAndBoundAvoidsChange() {
+    // 1 input 2 outputs legacy transaction is 226 vbytes, 1 input 1 output 192
+    let utxos = utxosWith([500_000, 101_920, 30_000, 71_920])
+    let selection = try! legacy.select(from: utxos, amount: 100_000)
+    XCTAssertEqual([101_920], selection.utxos.map { $0.amount })
+    XCTAssertEqual(1_920, selection.fee)
+    XCTAssertEqual(0, selection.change)
+  }
+
+  func testBranchAndBoundCombinesInputs() {
+    // 2 inputs 1 output: 10 + 2 * 148 + 34 = 340 vbytes
+    let utxos = utxosWith([60_000, 43_400, 500_000, 70_000])
+    let selection = try! legacy.select(from: utxos, amount: 100_000)
+    XCTAssertEqual([60_000, 43_400], selection.utxos.map { $0.amount }.sorted(by: >))
+    XCTAssertEqual(3_400, selection.fee)
+    XCTAssertEqual(0, selection.change)
+  }
+
+  func testLargestFirst() {
+    let utxos = utxosWith([10_000, 80_000, 20_000, 60_000])
+    let selection = try! segWit.select(from: utxos, amount: 100_000, strategy: .largestFirst)
+    XCTAssertEqual([80_000, 60_000], selection.utxos.map { $0.amount })
+    assertBalanced(selection, amount: 100_000)
+  }
+
+  func testKnapsack() {
+    var selector = segWit
+    selector.seed = 42
+    let utxos = utxosWith((1...200).map { Int64($0) * 1_000 })
+    let selection = try! selector.select(from: utxos, amount: 150_000, strategy: .knapsack)
+    assertBalanced(selection, amount: 150_000)
+    XCTAssert(selection.change == 0 || selection.change >= BTCTransactionSigner.dustThreshold)
+  }
+
+  func testDustChangeGoesToFee() {
+    let utxos = utxosWith([103_000])
+    let selection = try! legacy.select(from: utxos, amount: 100_000)
+    XCTAssertEqual(0, selection.change)
+    XCTAssertEqual(3_000, selection.fee)
+  }
+
+  func testUneconomicInputsSkipped() {
+    let utxos = utxosWith([1_000, 1_400, 200_000])
+    for strategy in [CoinSelectionStrategy.branchAndBound, .knapsack, .largestFirst] {
+      let selection = try! legacy.select(from: utxos, amount: 100_000, strategy: strategy)
+      XCTAssertEqual([200_000], selection.utxos.map { $0.amount })
+    }
+  }
+
+  func testInsufficientFunds() {
+    let utxos = utxosWith([50_000, 50_000])
+    XCTAssertThrowsError(try legacy.select(from: utxos, amount: 100_000)) { error in
+      XCTAssertEqual(GenericError.insufficientFunds, error as? GenericError)
+    }
+  }
+
+  func testPerformanceBranchAndBound() {
+    measureSelect(strategy: .branchAndBound)
+  }
+
+  func testPerformanceKnapsack() {
+    measureSelect(strategy: .knapsack)
+  }
+
+  func testPerformanceLargestFirst() {
+    measureSelect(strategy: .largestFirst)
+  }
+
+  private func measureSelect(strategy: CoinSelectionStrategy) {
+    let utxos = utxosWith((0..<20_000).map { Int64(2_000 + $0 * 7_919 % 200_000) })
+    measure {
+      let selection = try! segWit.select(from: utxos, amount: 50_000_000, strategy: strategy)
+      assertBalanced(selection, amount: 50_000_000)
+    }
+  }
+
+  private func assertBalanced(_ selection: CoinSelector.Selection, amount: Int64, file: StaticString = #file, line: UInt = #line) {
+    let total = selection.utxos.reduce(0) { $0 + $1.amount }
+    XCTAssertEqual(total, amount + selection.fee + selection.change, file: file, line: line)
+    XCTAssert(selection.fee > 0, file: file, line: line)
+  }
+
+  private func utxosWith(_ amounts: [Int64]) -> [UTXO] {
+    return amounts.enumerated().map { index, amount in
+      UTXO(txHash: String(format: "%064x", index), vout: 0, amount: amount, address: "", scriptPubKey: "76a914e6cfaab9a59ba187f0a45db0b169c21bb48f09b388ac", derivedPath: nil)
+    }
+  }
+}
@@ -53,4 +53,16 @@ class EOSKeyTests: TestCase {
     
   }
 
+  func testBatchEcRecover() {
+    let key = EOSKey(wif: TestData.eosPrivateKey)
+    let hashes = (0..<20).map { "imToken\($0)".data(using: .utf8)!.sha256() }
+    let signatures = hashes.map { EOSTransaction.signatureBase58(data: key.sign(data: $0)) }
+
+    let data = (0..<20).map { "imToken\($0)" } + ["imToken2016"]
+    let recovered = try! WalletManager.eosEcRecover(data: data, isHex: false, signatures: signatures + [signatures[0]])
+    XCTAssertEqual(Array(repeating: TestData.eosPublicKey, count: 20), Array(recovered.prefix(20)).map { $0! })
+    XCTAssertNotEqual(TestData.eosPublicKey, recovered[20])
+
+    XCTAssertThrowsError(try EOSKey.batchEcRecover(hashes: hashes, signatures: []))
+  }
 }
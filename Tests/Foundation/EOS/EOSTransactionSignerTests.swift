@@ -22,7 +22,7 @@ class EOSTransactionSignerTests: TestCase {
 //        chainID: TestData.eosChainID
 //      )
 //    ]
-//    let result = try! EOSTransactionSigner(txs: txs, keystore: wallet.keystore, password: TestData.password).sign()
+//    let result = try! EOSTransactionSigner(txs: txs, keystore: try! wallet.loadKeystore(), password: TestData.password).sign()
 //    XCTAssertEqual(1, result.count)
 //    XCTAssertEqual(
 //      result[0],
@@ -40,13 +40,44 @@ class EOSTransactionSignerTests: TestCase {
       )
     ]
     do {
-      _ = try EOSTransactionSigner(txs: txs, keystore: wallet.keystore, password: TestData.wrongPassword).sign()
+      _ = try EOSTransactionSigner(txs: txs, keystore: try! wallet.loadKeystore(), password: TestData.wrongPassword).sign()
       XCTFail()
     } catch let err {
       XCTAssertEqual(PasswordError.incorrect.localizedDescription, err.localizedDescription)
     }
   }
   
+  func testSignBatchMatchesSingle() {
+    let wallet = try! WalletManager.importEOS(from: TestData.mnemonic, accountName: "", permissions: [], metadata: WalletMeta(chain: .eos, source: .mnemonic), encryptBy: TestData.password, at: BIP44.eos)
+    let txs = makeTransactions(count: 10, publicKeys: (try! wallet.loadKeystore() as! EOSKeystore).publicKeys)
+
+    let keystore = try! wallet.loadKeystore() as! EOSKeystore
+    let results = try! EOSTransactionSigner(txs: txs, keystore: keystore, password: TestData.password).sign()
+    XCTAssertEqual(10, results.count)
+    for (i, result) in results.enumerated() {
+      XCTAssertEqual(signPerKey(transactionData(i), publicKeys: keystore.publicKeys, keystore: keystore), result)
+    }
+  }
+
+  func testSignWithUnknownPublicKey() {
+    let wallet = try! WalletManager.importEOS(from: TestData.mnemonic, accountName: "", permissions: [], metadata: WalletMeta(chain: .eos, source: .mnemonic), encryptBy: TestData.password, at: BIP44.eos)
+    let txs = makeTransactions(count: 2, publicKeys: ["EOS5SxZMjhKiXsmjxac8HBx56wWdZV1sCLZESh3ys1rzbMn4FUumU"])
+    XCTAssertThrowsError(try EOSTransactionSigner(txs: txs, keystore: try! wallet.loadKeystore(), password: TestData.password).sign()) { error in
+      XCTAssertEqual(EOSError.privatePublicNotMatch, error as? EOSError)
+    }
+  }
+
+  func testPerformanceSignBatch() {
+    let wallet = try! WalletManager.importEOS(from: TestData.mnemonic, accountName: "", permissions: [], metadata: WalletMeta(chain: .eos, source: .mnemonic), encryptBy: TestData.password, at: BIP44.eos)
+    let publicKey = (try! wallet.loadKeystore() as! EOSKeystore).publicKeys[0]
+    let txs = makeTransactions(count: 10, publicKeys: [publicKey, publicKey])
+
+    measure {
+      // 10 transactions with 2 signatures each, one KDF run and one key decryption
+      _ = try! EOSTransactionSigner(txs: txs, keystore: try! wallet.loadKeystore(), password: TestData.password).sign()
+    }
+  }
+
   func testSignHash() {
     let key = EOSKey(wif: "5KQwrPbwdL6PhXujxW37FSSQZ1JiwsST4cqQzDeyXtP79zkvFD3")
     
@@ -70,4 +101,29 @@ class EOSTransactionSignerTests: TestCase {
     }
     
   }
+
+  private func makeTransactions(count: Int, publicKeys: [String]) -> [EOSTransaction] {
+    return (0..<count).map { i in
+      EOSTransaction(data: transactionData(i), publicKeys: publicKeys, chainID: TestData.eosChainID)
+    }
+  }
+
+  private func transactionData(_ i: Int) -> String {
+    return String(format: "c578065b93aec6a7c811000000000100a6823403ea3055000000572d3ccdcd01000000602a48b37400000000a8ed323225000000602a48b374208410425c95b1ca80969800000000000453595300000000046d656d6f%02x", i)
+  }
+
+  /// Sign the way transactions were signed before batching: every signature decrypts its key with the password.
+  private func signPerKey(_ data: String, publicKeys: [String], keystore: EOSKeystore) -> EOSSignResult {
+    let toSign = NSMutableData()
+    toSign.append(TestData.eosChainID.tk_dataFromHexString()!)
+    toSign.append(data.tk_dataFromHexString()!)
+    toSign.append(Data(bytes: [UInt8](repeating: 0, count: 32)))
+    let hashedTx = BTCSHA256(toSign as Data) as Data
+
+    let signs = publicKeys.map { publicKey -> String in
+      let key = EOSKey(privateKey: try! keystore.decryptPrivateKey(from: publicKey, password: TestData.password))
+      return EOSTransaction.signatureBase58(data: key.sign(data: hashedTx))
+    }
+    return EOSSignResult(hash: Hex.toBytes(data).sha256().toHexString(), signs: signs)
+  }
 }
@@ -0,0 +1,41 @@
+//
+//  EIP55Tests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class EIP55Tests: XCTestCase {
+  let checksummed = [
+    "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed",
+    "0xfB6916095ca1df60bB79Ce92cE3Ea74c37c5d359",
+    "0xdbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB",
+    "0xD1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb"
+  ]
+
+  func testEncode() {
+    for address in checksummed {
+      XCTAssertEqual(address, EIP55.encode(address.lowercased()))
+      XCTAssertEqual(address, EIP55.encode(Hex.removePrefix(address).uppercased()))
+    }
+  }
+
+  func testEncodeInvalid() {
+    XCTAssertNil(EIP55.encode("0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAe"))
+    XCTAssertNil(EIP55.encode("0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAeg"))
+    XCTAssertNil(EIP55.encode(""))
+  }
+
+  func testIsValid() {
+    for address in checksummed {
+      XCTAssert(EIP55.isValid(address))
+      XCTAssert(EIP55.isValid(Hex.removePrefix(address)))
+      XCTAssertFalse(EIP55.isValid(address.lowercased()))
+    }
+    XCTAssertFalse(EIP55.isValid("0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAeD"))
+  }
+}
@@ -17,13 +17,13 @@ class ETHKeyTests: TestCase {
 
   func testAddressFromPrivateKey() {
     let ethKey1 = ETHKey(mnemonic: "course left dad either tribe curious edit refuse tongue whisper axis volume", path: BIP44.eth)
-    let ethKey2 = ETHKey(privateKey: ethKey1.privateKey)
+    let ethKey2 = ETHKey(privateKey: ethKey1.privateKey)!
     XCTAssertEqual(ethKey2.address, "08c1c4735f4103b4e6f6629d4efb12b5869b0de8")
   }
 
   func testAddressFromMnemonicWithIndex() {
     let ethKey1 = ETHKey(mnemonic: "course left dad either tribe curious edit refuse tongue whisper axis volume", path: "m/44'/60'/0'/0/3")
-    let ethKey2 = ETHKey(privateKey: ethKey1.privateKey)
+    let ethKey2 = ETHKey(privateKey: ethKey1.privateKey)!
     XCTAssertEqual(ethKey2.address, "c49da23670b4d0908626c36aa5d82f3acb4af8ce")
   }
 
@@ -48,4 +48,31 @@ class ETHKeyTests: TestCase {
       ETHKey.pubToAddress(Data(bytes: Hex.toBytes(publicKey)))
     )
   }
+
+  func testMnemonicToAddresses() {
+    let mnemonic = "course left dad either tribe curious edit refuse tongue whisper axis volume"
+    let addresses = ETHKey.mnemonicToAddresses(mnemonic, accountPath: "m/44'/60'/0'/0", indexes: 0..<5)
+    XCTAssertEqual(5, addresses.count)
+    XCTAssertEqual("08c1c4735f4103b4e6f6629d4efb12b5869b0de8", addresses[0])
+    XCTAssertEqual("c49da23670b4d0908626c36aa5d82f3acb4af8ce", addresses[3])
+    XCTAssertEqual(ETHKey.mnemonicToAddress(mnemonic, path: "m/44'/60'/0'/0/4"), addresses[4])
+  }
+
+  func testAddressOfPrivateKey() {
+    XCTAssertEqual("c2d7cf95645d33006175b78989035c7c9061d3f9", ETHKey.address(ofPrivateKey: Hex.toBytes("3a1076bf45ab87712ad64ccb3b10217737f7faacbf2872e88fdd9a537d8fe266")))
+    XCTAssertNil(ETHKey.address(ofPrivateKey: [UInt8](repeating: 0, count: 32)))
+    XCTAssertNil(ETHKey.address(ofPrivateKey: [1, 2, 3]))
+  }
+
+  func testInvalidPrivateKey() {
+    XCTAssertNil(ETHKey(privateKey: String(repeating: "0", count: 64)))
+    XCTAssertNil(ETHKey(privateKey: "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141"))
+    XCTAssertNil(ETHKey(privateKey: "3a1076bf"))
+  }
+
+  func testPerformanceMnemonicToAddresses() {
+    measure {
+      _ = ETHKey.mnemonicToAddresses("course left dad either tribe curious edit refuse tongue whisper axis volume", accountPath: "m/44'/60'/0'/0", indexes: 0..<100)
+    }
+  }
 }
@@ -118,6 +118,71 @@ class TransactionTests: TestCase {
     XCTAssertEqual("17624540777746785479194051974711071979083475571118607927022572721095387941", BigUInt(signature["s"]!, radix: 16)!.description)
   }
 
+  func testBatchSign() {
+    let privateKey = "4646464646464646464646464646464646464646464646464646464646464646"
+    let raws = (0..<3).map { nonce -> [String: String] in
+      return [
+        "nonce":        String(nonce),
+        "gasPrice":     "20000000000",
+        "gasLimit":     "21000",
+        "to":           "0x3535353535353535353535353535353535353535",
+        "value":        "1000000000000000000",
+        "data":         ""
+      ]
+    }
+    let results = Transaction.sign(raws.map { Transaction(raw: $0, chainID: 1) }, with: privateKey)
+    XCTAssertEqual(3, results.count)
+    for (raw, result) in zip(raws, results) {
+      let tx = Transaction(raw: raw, chainID: 1)
+      _ = tx.sign(with: privateKey)
+      XCTAssertEqual(tx.signedResult.signedTx, result.signedTx)
+      XCTAssertEqual(tx.signedResult.txHash, result.txHash)
+    }
+  }
+
+  func testSignWithInvalidKey() {
+    let tx = Transaction(raw: ["nonce": "0", "gasPrice": "1", "gasLimit": "21000", "to": "", "value": "0", "data": ""], chainID: 1)
+    let signature = tx.sign(with: "00")
+    XCTAssertEqual("", signature["r"])
+    XCTAssertEqual("", signature["s"])
+  }
+
+  func testPerformanceBatchSign() {
+    let privateKey = "4646464646464646464646464646464646464646464646464646464646464646"
+    let raws = (0..<1000).map { nonce -> [String: String] in
+      return [
+        "nonce":        String(nonce),
+        "gasPrice":     "20000000000",
+        "gasLimit":     "21000",
+        "to":           "0x3535353535353535353535353535353535353535",
+        "value":        "1000000000000000000",
+        "data":         "0xa9059cbb000000000000000000000000353535353535353535353535353535353535353500000000000000000000000000000000000000000000000000000000000003e8"
+      ]
+    }
+    measure {
+      _ = Transaction.sign(raws.map { Transaction(raw: $0, chainID: 1) }, with: privateKey)
+    }
+  }
+
+  func testPerformanceParseAndSerialize() {
+    let raws = (0..<1000).map { nonce -> [String: String] in
+      return [
+        "nonce":        String(nonce),
+        "gasPrice":     "20000000000",
+        "gasLimit":     "21000",
+        "to":           "0x3535353535353535353535353535353535353535",
+        "value":        "115792089237316195423570985008687907853269984665640564039457584007913129639935",
+        "data":         "0xa9059cbb000000000000000000000000353535353535353535353535353535353535353500000000000000000000000000000000000000000000000000000000000003e8",
+        "v":            "37",
+        "r":            "28ef61340bd939bc2195fe537567866003e1a15d3c71ff63e1590620aa636276",
+        "s":            "67cbe9d8997f761aecb703304b3800ccf555c9f3dc64214b297fb1966a3b6d83"
+      ]
+    }
+    measure {
+      raws.forEach { _ = Transaction(raw: $0, chainID: 1).signedTx }
+    }
+  }
+
   // MARK: - Failing tests from ttTransactonTest
 
   func testAddressLessThan20Prefixed0() {
@@ -26,6 +26,40 @@ class MnemonicTests: TestCase {
     }
   }
 
+  func testCodecJSONFixture() {
+    let json = TestHelper.loadJSON(filename: "mnemonic")
+    let jsonObject = try! JSONSerialization.jsonObject(with: json.data(using: .utf8)!) as! [String: Any]
+    for (index, example) in (jsonObject["english"] as! [[String]]).enumerated() {
+      let entropy = Hex.toBytes(example[0])
+      let words = example[1].components(separatedBy: " ")
+      XCTAssertEqual(words, try MnemonicCodec.words(from: entropy), "Words from entropy #\(index)")
+      XCTAssertEqual(entropy, try MnemonicCodec.entropy(from: words), "Entropy from words #\(index)")
+    }
+  }
+
+  func testCodecInvalid() {
+    XCTAssertThrowsError(try MnemonicCodec.words(from: [UInt8](repeating: 0, count: 15)))
+    let cases: [(String, MnemonicError)] = [
+      ("inject kidney empty canal shadow pact comfort wife crush horse wife", .lengthInvalid),
+      ("inject kidney empty canal shadow pact comfort wife crush horse wife sketchy", .wordInvalid),
+      ("inject kidney empty canal shadow pact comfort wife crush horse wife wife", .checksumInvalid)
+    ]
+    for (mnemonic, expected) in cases {
+      XCTAssertThrowsError(try MnemonicCodec.entropy(from: mnemonic.split(separator: " "))) { error in
+        XCTAssertEqual(expected, error as? MnemonicError)
+      }
+    }
+  }
+
+  func testPerformanceCodec() {
+    let words = TestData.mnemonic.split(separator: " ")
+    measure {
+      for _ in 0..<10_000 {
+        _ = try! MnemonicCodec.words(from: MnemonicCodec.entropy(from: words))
+      }
+    }
+  }
+
   func testRandom() {
     let random = ETHMnemonic().mnemonic
     XCTAssertEqual(12, random.components(separatedBy: " ").count)
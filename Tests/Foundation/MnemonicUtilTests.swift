@@ -20,4 +20,14 @@ class MnemonicUtilTests: TestCase {
     let seed = MnemonicUtil.btcMnemonicFromEngWords(TestData.mnemonic).seed.tk_toHexString()
     XCTAssertEqual(TestData.seed, seed)
   }
+
+  func testSeed() {
+    XCTAssertEqual(TestData.seed, try MnemonicUtil.seed(from: TestData.mnemonic).tk_toHexString())
+    XCTAssertThrowsError(try MnemonicUtil.seed(from: "inject kidney empty canal shadow pact comfort wife crush horse wife notaword"))
+  }
+
+  func testSeeds() {
+    let seeds = try! MnemonicUtil.seeds(from: [TestData.mnemonic, TestData.mnemonic])
+    XCTAssertEqual([TestData.seed, TestData.seed], seeds.map { $0.tk_toHexString() })
+  }
 }
@@ -0,0 +1,77 @@
+//
+//  UTXOKeyDeriverTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+import CoreBitcoin
+@testable import TokenCore
+
+class UTXOKeyDeriverTests: XCTestCase {
+  private let keychain = MnemonicUtil.btcMnemonicFromEngWords(TestData.mnemonic).keychain.derivedKeychain(withPath: BIP44.btcTestnet)!
+
+  func testKeysMatchPathDerivation() {
+    let paths = ["0/0", "0/1", "1/5", "0/0", "0/1/2", "1/0"]
+    let keys = try! UTXOKeyDeriver(keychain: keychain, isSegWit: false).keys(for: paths.map { utxo(derivedPath: $0) })
+
+    XCTAssertEqual(paths.count, keys.count)
+    for (path, key) in zip(paths, keys) {
+      XCTAssertEqual(keychain.key(withPath: "/\(path)").privateKey, key.privateKey)
+      XCTAssert(key.isPublicKeyCompressed)
+    }
+    XCTAssert(keys[0] === keys[3])
+  }
+
+  func testFindKeyByScript() {
+    for isSegWit in [false, true] {
+      let expected = keychain.key(withPath: "/1/3")!
+      let script = self.script(of: expected, isSegWit: isSegWit)
+      BTCMnemonicKeystore.scriptDerivedPathCache[script] = nil
+
+      let keys = try! UTXOKeyDeriver(keychain: keychain, isSegWit: isSegWit).keys(for: [utxo(derivedPath: "0/2"), utxo(script: script)])
+      XCTAssertEqual(expected.privateKey, keys[1].privateKey)
+      XCTAssertEqual("1/3", BTCMnemonicKeystore.scriptDerivedPathCache[script])
+    }
+  }
+
+  func testPerformanceDerive500Inputs() {
+    let utxos = (0..<500).map { utxo(derivedPath: "\($0 % 2)/\($0 / 2)") }
+    measure {
+      _ = try! UTXOKeyDeriver(keychain: keychain, isSegWit: true).keys(for: utxos)
+    }
+  }
+
+  /// Scan latency of an input without derived path at a low index, e.g. a recent change output.
+  func testPerformanceFindLowIndexScript() {
+    let script = self.script(of: keychain.key(withPath: "/1/2")!, isSegWit: true)
+    measure {
+      BTCMnemonicKeystore.scriptDerivedPathCache[script] = nil
+      let keys = try! UTXOKeyDeriver(keychain: keychain, isSegWit: true).keys(for: [utxo(script: script)])
+      XCTAssertEqual(1, keys.count)
+    }
+  }
+
+  /// Key derivation and signing latency of a 500 inputs SegWit transaction.
+  func testPerformanceSign500Inputs() {
+    let utxos = (0..<500).map { utxo(derivedPath: "0/\($0)", amount: 10_000) }
+    let toAddress = BTCAddress(string: "2N9wBy6f1KTUF5h2UUeqRdKnBT6oSMh4Whp")!
+    let changeAddress = keychain.changeKey(at: 0).address(on: .testnet, segWit: .p2wpkh)
+    measure {
+      let keys = try! UTXOKeyDeriver(keychain: keychain, isSegWit: true).keys(for: utxos)
+      let signer = try! BTCTransactionSigner(utxos: utxos, keys: keys, amount: 4_000_000, fee: 50_000, toAddress: toAddress, changeAddress: changeAddress)
+      _ = try! signer.signSegWit()
+    }
+  }
+
+  private func script(of key: BTCKey, isSegWit: Bool) -> String {
+    let hash160 = BTCMnemonicKeystore.hashPubKey(key.publicKey! as Data, isSegWit: isSegWit).tk_toHexString()
+    return isSegWit ? "a914\(hash160)87" : "76a914\(hash160)88ac"
+  }
+
+  private func utxo(derivedPath: String? = nil, script: String = "a9142d2b1ef5ee4cf6c3ebc8cf66a602783798f7875987", amount: Int64 = 50_000) -> UTXO {
+    return UTXO(txHash: "c2ceb5088cf39b677705526065667a3992c68cc18593a9af12607e057672717f", vout: 0, amount: amount, address: "", scriptPubKey: script, derivedPath: derivedPath)
+  }
+}
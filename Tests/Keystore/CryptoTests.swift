@@ -32,6 +32,22 @@ class CryptoTests: TestCase {
     XCTAssertEqual(TestData.privateKey, crypto.privateKey(password: TestData.password))
   }
 
+  func testUnlock() {
+    let crypto = Crypto(password: TestData.password, privateKey: TestData.privateKey)
+    let unlocked = try! crypto.unlock(password: TestData.password)
+    XCTAssertEqual(TestData.privateKey, unlocked.privateKey())
+
+    let message = EncryptedMessage.create(crypto: crypto, password: TestData.password, message: "0123456789abcdef")
+    XCTAssertEqual("0123456789abcdef", message.decrypt(with: unlocked))
+  }
+
+  func testUnlockWithWrongPassword() {
+    let crypto = Crypto(password: TestData.password, privateKey: TestData.privateKey)
+    XCTAssertThrowsError(try crypto.unlock(password: TestData.wrongPassword)) { error in
+      XCTAssertEqual(PasswordError.incorrect, error as? PasswordError)
+    }
+  }
+
   func testInitWithInvalidJSON() {
     let json = ["bad": "json"]
     XCTAssertThrowsError(try Crypto(json: json))
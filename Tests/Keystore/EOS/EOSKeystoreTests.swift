@@ -119,7 +119,7 @@ class EOSKeystoreTests: TestCase {
     do {
       let keystoreJson = TestHelper.loadJSON(filename: "42c275c6-957a-49e8-9eb3-43c21cbf583f")
       let wallet = try BasicWallet(json: (try keystoreJson.tk_toJSON()))
-      XCTAssertNotNil(wallet.keystore as? EOSLegacyKeystore)
+      XCTAssertNotNil(try! wallet.loadKeystore() as? EOSLegacyKeystore)
     } catch {
       XCTFail("Some error happen \(error)")
     }
@@ -17,6 +17,13 @@ class ETHKeystoreTests: TestCase {
     XCTAssertEqual("6031564e7b2f5cc33737807b2e58daff870b590b", keystore?.address)
   }
 
+  func testImportInvalidPrivateKey() {
+    let meta = WalletMeta(chain: .eth, source: .privateKey)
+    XCTAssertThrowsError(try ETHKeystore(password: TestData.password, privateKey: String(repeating: "0", count: 64), metadata: meta)) { error in
+      XCTAssertEqual(PrivateKeyError.invalid, error as? PrivateKeyError)
+    }
+  }
+
   func testInitWithJSON() {
     let data = TestHelper.loadJSON(filename: "v3-pbkdf2-testpassword").data(using: .utf8)!
     let json = try! JSONSerialization.jsonObject(with: data) as! JSONObject
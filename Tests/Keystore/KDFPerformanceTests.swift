@@ -69,4 +69,36 @@ class KDFPerformanceTests: XCTestCase { // Do NOT inherit from TestCase, which d
       /// * After caching derivedKey: 8 sec
     }
   }
+
+  func testDeriveWalletsConcurrently() {
+    Crypto.ScryptKdfparams.defaultN = 1024
+    StorageManager.storageType = InMemoryStorage.self
+    var metadata = WalletMeta(source: .newIdentity)
+    metadata.network = .mainnet
+    let (mnemonic, identity) = try! Identity.createIdentity(password: TestData.password, metadata: metadata)
+    identity.wallets.forEach { _ = identity.removeWallet($0) }
+
+    measure {
+      Crypto.ScryptKdfparams.defaultN = 262_144
+
+      /// Derive 3 wallets from one seed, their KDF run concurrently.
+      /// Compare with testDeriveWalletsSerial.
+      let wallets = try! identity.deriveWallets(for: [.eth, .btc, .eos], mnemonic: mnemonic, password: TestData.password)
+      wallets.forEach { _ = identity.removeWallet($0) }
+    }
+  }
+
+  func testRecoverIdentity() {
+    StorageManager.storageType = InMemoryStorage.self
+    var metadata = WalletMeta(source: .recoveredIdentity)
+    metadata.network = .mainnet
+
+    measure {
+      Crypto.ScryptKdfparams.defaultN = 262_144
+
+      /// Identity keystore, ETH and BTC keystores are created concurrently from one seed.
+      /// Should measure this on a device, it runs as many KDF at a time as there are cores.
+      _ = try! Identity.recoverIdentity(metadata: metadata, mnemonic: TestData.mnemonic, password: TestData.password)
+    }
+  }
 }
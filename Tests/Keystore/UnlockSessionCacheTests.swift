@@ -0,0 +1,66 @@
+//
+//  UnlockSessionCacheTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class UnlockSessionCacheTests: TestCase {
+  private var wallet: BasicWallet!
+
+  override func setUp() {
+    super.setUp()
+    UnlockSessionCache.isEnabled = true
+    UnlockSessionCache.ttl = 300
+    var meta = WalletMeta(source: .privateKey)
+    meta.chain = .eth
+    wallet = try! WalletManager.importFromPrivateKey(TestData.privateKey, encryptedBy: TestData.password, metadata: meta)
+  }
+
+  override func tearDown() {
+    UnlockSessionCache.isEnabled = false
+    super.tearDown()
+  }
+
+  func testUnlockWithCorrectPassword() {
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+    XCTAssertEqual(TestData.privateKey, try wallet.privateKey(password: TestData.password))
+    XCTAssert(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+    XCTAssertEqual(TestData.privateKey, try wallet.privateKey(password: TestData.password))
+  }
+
+  func testWrongPasswordIsNotCached() {
+    XCTAssertThrowsError(try wallet.privateKey(password: TestData.wrongPassword))
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+
+    _ = try! wallet.privateKey(password: TestData.password)
+    XCTAssertThrowsError(try wallet.privateKey(password: TestData.wrongPassword))
+  }
+
+  func testExpire() {
+    UnlockSessionCache.ttl = 0.1
+    _ = try! wallet.privateKey(password: TestData.password)
+    Thread.sleep(forTimeInterval: 0.2)
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+  }
+
+  func testLock() {
+    _ = try! wallet.privateKey(password: TestData.password)
+    UnlockSessionCache.lock(walletID: wallet.walletID)
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+
+    _ = try! wallet.privateKey(password: TestData.password)
+    UnlockSessionCache.isEnabled = false
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+  }
+
+  func testRemoveWalletLocks() {
+    _ = try! wallet.privateKey(password: TestData.password)
+    XCTAssert(wallet.delete())
+    XCTAssertFalse(UnlockSessionCache.isUnlocked(walletID: wallet.walletID))
+  }
+}
@@ -0,0 +1,120 @@
+//
+//  BinaryKeystoreTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class BinaryKeystoreTests: TestCase {
+  func testRoundTrip() {
+    let identity = Identity.currentIdentity!
+    let eosWallet = try! identity.importEOS(from: TestData.mnemonic, accountName: "", permissions: [], metadata: WalletMeta(chain: .eos, source: .mnemonic), encryptBy: TestData.password, at: BIP44.eosLedger)
+
+    for wallet in identity.wallets + [eosWallet] {
+      let keystore = try! wallet.loadKeystore()
+      let decoded = BinaryKeystore.withFields(stored: BinaryKeystore.encode(keystore.toJSON())) { try BasicWallet.keystore(fields: $0) }!
+      XCTAssert(type(of: keystore) == type(of: decoded))
+      XCTAssertEqual(NSDictionary(dictionary: keystore.toJSON()), NSDictionary(dictionary: decoded.toJSON()))
+    }
+
+    let loaded = BinaryKeystore.withFields(stored: BinaryKeystore.encode(identity.keystore.toJSON())) { Identity(fields: $0) }!
+    XCTAssertEqual(identity.identifier, loaded.identifier)
+    XCTAssertEqual(identity.keystore.walletIds, loaded.keystore.walletIds)
+    XCTAssertEqual(identity.wallets.map { $0.address }, loaded.wallets.map { $0.address })
+    XCTAssert(loaded.keystore.verify(password: TestData.password))
+  }
+
+  func testKeepValues() {
+    let json: JSONObject = [
+      "hex": "00ff",
+      "upperHex": "00FF",
+      "prefixedHex": "0x00ff",
+      "oddHex": "abc",
+      "empty": "",
+      "int": -262144,
+      "double": 1.5,
+      "bool": true,
+      "strings": ["a0", "b"],
+      "array": [1, "a0", NSNull()] as [Any],
+      "objects": [["n": 1], ["n": 2]],
+      "object": ["nested": ["deep": "value"]]
+    ]
+    let isRead = BinaryKeystore.withFields(stored: BinaryKeystore.encode(json)) { fields -> Bool in
+      XCTAssertEqual("00ff", fields.string("hex"))
+      XCTAssertEqual("00FF", fields.string("upperHex"))
+      XCTAssertEqual("0x00ff", fields.string("prefixedHex"))
+      XCTAssertEqual("abc", fields.string("oddHex"))
+      XCTAssertEqual("", fields.string("empty"))
+      XCTAssertEqual(-262144, fields.int("int"))
+      XCTAssertEqual(["a0", "b"], fields.strings("strings")!)
+      XCTAssertEqual([1, 2], fields.objects("objects")!.map { $0.int("n")! })
+      XCTAssertEqual("value", fields.object("object")?.object("nested")?.string("deep"))
+      return true
+    }
+    XCTAssertEqual(true, isRead)
+  }
+
+  func testOtherTypesReadAsNil() {
+    let json: JSONObject = ["int": 1, "string": "a", "array": [1, "a0"] as [Any], "double": 1.5, "bool": true]
+    let isRead = BinaryKeystore.withFields(stored: BinaryKeystore.encode(json)) { fields -> Bool in
+      XCTAssertNil(fields.string("int"))
+      XCTAssertNil(fields.int("string"))
+      XCTAssertNil(fields.int("double"))
+      XCTAssertNil(fields.int("bool"))
+      XCTAssertNil(fields.string("missing"))
+      XCTAssertNil(fields.strings("array"))
+      XCTAssertNil(fields.objects("array"))
+      XCTAssertNil(fields.object("string"))
+      return true
+    }
+    XCTAssertEqual(true, isRead)
+  }
+
+  func testDecodeInvalid() {
+    let bytes = BinaryKeystore.encode(try! Identity.currentIdentity!.wallets[0].loadKeystore().toJSON())
+    XCTAssertNotNil(BinaryKeystore.withFields(stored: bytes) { _ in true })
+    XCTAssertNil(BinaryKeystore.withFields(stored: Array(bytes.dropLast())) { _ in true })
+    XCTAssertNil(BinaryKeystore.withFields(stored: bytes + [0]) { _ in true })
+
+    var unknownVersion = bytes
+    unknownVersion[3] = BinaryKeystore.version + 1
+    XCTAssertNil(BinaryKeystore.withFields(stored: unknownVersion) { _ in true })
+  }
+
+  func testLoadJSONText() {
+    let keystore = try! Identity.currentIdentity!.wallets[0].loadKeystore()
+    let content = Array(keystore.dump().utf8)
+    XCTAssertFalse(BinaryKeystore.isBinary(content))
+    XCTAssertEqual(keystore.address, BinaryKeystore.withFields(stored: content) { $0.string("address") })
+    XCTAssertEqual(keystore.id, BinaryKeystore.withFields(stored: content) { try BasicWallet(fields: $0) }?.walletID)
+  }
+
+  func testSmallerThanJSON() {
+    for wallet in Identity.currentIdentity!.wallets {
+      let jsonSize = try! wallet.loadKeystore().dump().utf8.count
+      XCTAssertLessThan(BinaryKeystore.encode(try! wallet.loadKeystore().toJSON()).count, jsonSize * 4 / 5)
+    }
+  }
+
+  func testPerformanceStoreAndLoadBinary1k() {
+    let keystore = try! Identity.currentIdentity!.wallets[0].loadKeystore()
+    measure {
+      for _ in 0..<1_000 {
+        _ = BinaryKeystore.withFields(stored: BinaryKeystore.encode(keystore.toJSON())) { try BasicWallet(fields: $0) }!
+      }
+    }
+  }
+
+  func testPerformanceStoreAndLoadJSON1k() {
+    let keystore = try! Identity.currentIdentity!.wallets[0].loadKeystore()
+    measure {
+      for _ in 0..<1_000 {
+        _ = try! BasicWallet(json: try! keystore.dump().tk_toJSON())
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+//
+//  KeystorePackStorageTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class KeystorePackStorageTests: TestCase {
+  private var packURL: URL!
+
+  override func setUp() {
+    super.setUp()
+    packURL = URL(fileURLWithPath: NSTemporaryDirectory()).appendingPathComponent("\(UUID().uuidString).pack")
+  }
+
+  override func tearDown() {
+    try? FileManager.default.removeItem(at: packURL)
+    super.tearDown()
+  }
+
+  func testLoad() {
+    let identity = Identity.currentIdentity!
+    XCTAssertNoThrow(try KeystorePackStorage.write(identity: identity.keystore, keystores: identity.wallets.map { try! $0.loadKeystore() }, to: packURL))
+
+    let storage = KeystorePackStorage(url: packURL)
+    XCTAssertEqual(identity.identifier, storage.tryLoadIdentity()?.identifier)
+    let walletIDs = identity.wallets.map { $0.walletID }
+    XCTAssertEqual(walletIDs, storage.loadWalletByIDs(walletIDs + ["abcd"]).map { $0.walletID })
+    XCTAssertEqual(walletIDs.reversed(), storage.loadWalletByIDs(walletIDs.reversed()).map { $0.walletID })
+
+    let ethAddress = identity.wallets[0].address
+    XCTAssertEqual(ethAddress, storage.loadWallet(address: ethAddress.uppercased().add0xIfNeeded(), on: .eth)?.address)
+    XCTAssertEqual(identity.wallets[1].walletID, storage.loadWallet(address: identity.wallets[1].address, on: .btc)?.walletID)
+    XCTAssertNil(storage.loadWallet(address: ethAddress, on: .btc))
+  }
+
+  func testReadOnly() {
+    let identity = Identity.currentIdentity!
+    try! KeystorePackStorage.write(identity: nil, keystores: identity.wallets.map { try! $0.loadKeystore() }, to: packURL)
+
+    let storage = KeystorePackStorage(url: packURL)
+    XCTAssertNil(storage.tryLoadIdentity())
+    XCTAssertFalse(storage.flushWallet(try! identity.wallets[0].loadKeystore(), identity: identity.keystore))
+    XCTAssertFalse(storage.deleteWalletByID(identity.wallets[0].walletID))
+    XCTAssertFalse(storage.cleanStorage())
+    XCTAssertEqual(1, storage.loadWalletByIDs([identity.wallets[0].walletID]).count)
+  }
+
+  func testInvalidPack() {
+    XCTAssertNil(KeystorePackStorage(url: packURL).tryLoadIdentity())
+
+    let identity = Identity.currentIdentity!
+    try! KeystorePackStorage.write(identity: identity.keystore, keystores: identity.wallets.map { try! $0.loadKeystore() }, to: packURL)
+    let data = try! Data(contentsOf: packURL)
+    // Indexes cut off
+    try! data.prefix(24).write(to: packURL)
+
+    let storage = KeystorePackStorage(url: packURL)
+    XCTAssertNil(storage.tryLoadIdentity())
+    XCTAssertEqual(0, storage.loadWalletByIDs(identity.wallets.map { $0.walletID }).count)
+  }
+
+  func testWriteThrows() {
+    let url = packURL.appendingPathComponent("missing").appendingPathComponent("keystores.pack")
+    XCTAssertThrowsError(try KeystorePackStorage.write(identity: nil, keystores: [], to: url))
+  }
+
+  func testPerformanceOpenAndFind10k() {
+    var template = try! Identity.currentIdentity!.wallets[0].loadKeystore().toJSON()
+    let keystores: [Keystore] = (0..<10_000).map { _ in
+      template["id"] = UUID().uuidString.lowercased()
+      return try! ETHMnemonicKeystore(json: template)
+    }
+    try! KeystorePackStorage.write(identity: nil, keystores: keystores, to: packURL)
+    let walletIDs = keystores.prefix(100).map { $0.id }
+
+    measure {
+      let storage = KeystorePackStorage(url: packURL)
+      XCTAssertEqual(100, storage.loadWalletByIDs(walletIDs).count)
+    }
+  }
+}
@@ -31,7 +31,7 @@ class LocalFileStorageTests: TestCase {
     let metadata = WalletMeta(chain: .eth, source: .mnemonic)
     let identity = Identity.currentIdentity!
     let wallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.eth)
-    _ = storage.flushWallet(wallet.keystore)
+    _ = storage.flushWallet(try! wallet.loadKeystore())
 
     XCTAssertEqual(1, storage.loadWalletByIDs([wallet.walletID]).count)
   }
@@ -43,7 +43,7 @@ class LocalFileStorageTests: TestCase {
     let metadata = WalletMeta(chain: .eth, source: .mnemonic)
     let identity = Identity.currentIdentity!
     let wallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.eth)
-    _ = storage.flushWallet(wallet.keystore)
+    _ = storage.flushWallet(try! wallet.loadKeystore())
     XCTAssert(storage.deleteWalletByID(wallet.walletID))
   }
 
@@ -70,6 +70,24 @@ class LocalFileStorageTests: TestCase {
     let metadata = WalletMeta(chain: .eth, source: .mnemonic)
     let identity = Identity.currentIdentity!
     let wallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.eth)
-    XCTAssert(storage.flushWallet(wallet.keystore))
+    XCTAssert(storage.flushWallet(try! wallet.loadKeystore()))
+  }
+
+  func testWriteJSONTextReadBinary() {
+    let storage: Storage = LocalFileStorage()
+
+    let metadata = WalletMeta(chain: .eth, source: .mnemonic)
+    let identity = Identity.currentIdentity!
+    let wallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.eth)
+    let keystore = try! wallet.loadKeystore()
+    _ = storage.flushWallet(keystore)
+
+    // Earlier versions parse wallet files as JSON text
+    let filePath = "\(NSHomeDirectory())/Documents/wallets/\(wallet.walletID)"
+    let json = try! String(contentsOfFile: filePath, encoding: .utf8).tk_toJSON()
+    XCTAssertEqual(keystore.address, json["address"] as? String)
+
+    try! Data(bytes: BinaryKeystore.encode(keystore.toJSON())).write(to: URL(fileURLWithPath: filePath))
+    XCTAssertEqual(keystore.address, storage.loadWalletByIDs([wallet.walletID]).first?.address)
   }
 }
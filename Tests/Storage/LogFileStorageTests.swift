@@ -0,0 +1,205 @@
+//
+//  LogFileStorageTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+import CryptoSwift
+@testable import TokenCore
+
+class LogFileStorageTests: TestCase {
+  private var directory: URL!
+  private var logPath: String {
+    return directory.appendingPathComponent("keystores.log").path
+  }
+  private var wallet: BasicWallet!
+  private var identityKeystore: IdentityKeystore {
+    return Identity.currentIdentity!.keystore
+  }
+
+  override func setUp() {
+    super.setUp()
+    directory = URL(fileURLWithPath: NSTemporaryDirectory()).appendingPathComponent(UUID().uuidString)
+    try! FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true, attributes: nil)
+    wallet = Identity.currentIdentity!.wallets.first!
+  }
+
+  override func tearDown() {
+    LogFileStorage.compactionMinSize = 1 << 20
+    try? FileManager.default.removeItem(at: directory)
+    super.tearDown()
+  }
+
+  func testReload() {
+    let storage = LogFileStorage(directory: directory)
+    XCTAssertNil(storage.tryLoadIdentity())
+    XCTAssert(storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore))
+
+    let reloaded = LogFileStorage(directory: directory)
+    XCTAssertNotNil(reloaded.tryLoadIdentity())
+    XCTAssertEqual([wallet.address], reloaded.loadWalletByIDs([wallet.walletID, "abcd"]).map { $0.address })
+  }
+
+  func testRemoveWallet() {
+    let storage = LogFileStorage(directory: directory)
+    _ = storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore)
+    XCTAssert(storage.removeWallet(wallet.walletID, identity: identityKeystore))
+    XCTAssertFalse(storage.deleteWalletByID(wallet.walletID))
+
+    XCTAssertEqual(0, LogFileStorage(directory: directory).loadWalletByIDs([wallet.walletID]).count)
+  }
+
+  func testDropTornRecord() {
+    let storage = LogFileStorage(directory: directory)
+    _ = storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore)
+    let validSize = fileSize()
+
+    // Interrupted commit: header promises more than was written
+    let handle = FileHandle(forWritingAtPath: logPath)!
+    handle.seekToEndOfFile()
+    handle.write(Data(bytes: [0, 0, 1, 0, 1, 2, 3, 4, 1, 0]))
+    handle.closeFile()
+
+    let reloaded = LogFileStorage(directory: directory)
+    XCTAssertEqual(1, reloaded.loadWalletByIDs([wallet.walletID]).count)
+    XCTAssertEqual(validSize, fileSize())
+    XCTAssert(reloaded.flushIdentity(identityKeystore))
+    XCTAssertNotNil(LogFileStorage(directory: directory).tryLoadIdentity())
+  }
+
+  func testDropCorruptRecord() {
+    let storage = LogFileStorage(directory: directory)
+    _ = storage.flushIdentity(identityKeystore)
+    _ = storage.flushWallet(try! wallet.loadKeystore())
+
+    var bytes = [UInt8](FileManager.default.contents(atPath: logPath)!)
+    bytes[bytes.count - 1] ^= 0xff
+    FileManager.default.createFile(atPath: logPath, contents: Data(bytes: bytes))
+
+    let reloaded = LogFileStorage(directory: directory)
+    XCTAssertNotNil(reloaded.tryLoadIdentity())
+    XCTAssertEqual(0, reloaded.loadWalletByIDs([wallet.walletID]).count)
+  }
+
+  func testKeepUnknownRecord() {
+    let storage = LogFileStorage(directory: directory)
+    _ = storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore)
+
+    // Checksummed record of a tag a newer build may write
+    let payload: [UInt8] = [0x7f, 0, 0, 0, 1, 0x61, 0, 0, 0, 0]
+    var record = [UInt8]()
+    for value in [UInt32(payload.count), payload.crc32()] {
+      record += [24, 16, 8, 0].map { UInt8(truncatingIfNeeded: value >> $0) }
+    }
+    record += payload
+    let handle = FileHandle(forWritingAtPath: logPath)!
+    handle.seekToEndOfFile()
+    handle.write(Data(bytes: record))
+    handle.closeFile()
+    let size = fileSize()
+
+    let reloaded = LogFileStorage(directory: directory)
+    XCTAssert(reloaded.isReadOnly)
+    XCTAssertEqual(1, reloaded.loadWalletByIDs([wallet.walletID]).count)
+    XCTAssertFalse(reloaded.flushIdentity(identityKeystore))
+    XCTAssertEqual(size, fileSize())
+  }
+
+  func testCompaction() {
+    LogFileStorage.compactionMinSize = 16 * 1024
+    let storage = LogFileStorage(directory: directory)
+    for _ in 0..<100 {
+      XCTAssert(storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore))
+    }
+    XCTAssertLessThan(fileSize(), LogFileStorage.compactionMinSize)
+
+    let reloaded = LogFileStorage(directory: directory)
+    XCTAssertNotNil(reloaded.tryLoadIdentity())
+    XCTAssertEqual(1, reloaded.loadWalletByIDs([wallet.walletID]).count)
+  }
+
+  func testCleanStorage() {
+    let storage = LogFileStorage(directory: directory)
+    _ = storage.flushWallet(try! wallet.loadKeystore(), identity: identityKeystore)
+    XCTAssert(storage.cleanStorage())
+    XCTAssertNil(storage.tryLoadIdentity())
+    XCTAssertNil(LogFileStorage(directory: directory).tryLoadIdentity())
+  }
+
+  func testWalletIndexChanges() {
+    let storage = LogFileStorage(directory: directory)
+    var identity = identityKeystore
+    XCTAssert(storage.flushIdentity(identity))
+
+    let keystores = newKeystores(3)
+    for keystore in keystores {
+      identity.wallets.append(BasicWallet(keystore))
+      identity.walletIds.append(keystore.id)
+      let size = fileSize()
+      XCTAssert(storage.flushWallet(keystore, identity: identity))
+      // Wallet and its index entry, not the identity
+      XCTAssertLessThan(fileSize() - size, BinaryKeystore.encode(keystore.toJSON()).count + 256)
+    }
+    identity.wallets.remove(at: 3)
+    identity.walletIds.remove(at: 3)
+    XCTAssert(storage.removeWallet(keystores[1].id, identity: identity))
+
+    let reloaded = LogFileStorage(directory: directory).tryLoadIdentity()!
+    XCTAssertEqual(identity.walletIds, reloaded.keystore.walletIds)
+    XCTAssertEqual(identity.wallets.map { $0.address }, reloaded.wallets.map { $0.address })
+    XCTAssertEqual(1, LogFileStorage(directory: directory).loadWalletByIDs([keystores[0].id, keystores[1].id]).count)
+  }
+
+  func testCompactionFoldsWalletIndex() {
+    LogFileStorage.compactionMinSize = 16 * 1024
+    let storage = LogFileStorage(directory: directory)
+    var identity = identityKeystore
+    XCTAssert(storage.flushIdentity(identity))
+    for keystore in newKeystores(50) {
+      identity.wallets.append(BasicWallet(keystore))
+      identity.walletIds.append(keystore.id)
+      XCTAssert(storage.flushWallet(keystore, identity: identity))
+      identity.wallets.removeLast()
+      identity.walletIds.removeLast()
+      XCTAssert(storage.removeWallet(keystore.id, identity: identity))
+    }
+    XCTAssertLessThan(fileSize(), LogFileStorage.compactionMinSize)
+    XCTAssertEqual(identity.walletIds, LogFileStorage(directory: directory).tryLoadIdentity()!.keystore.walletIds)
+  }
+
+  /// Import then delete 10k wallets of an identity listing all of them.
+  func testPerformanceImportAndDelete10k() {
+    let keystores = newKeystores(10_000)
+    measure {
+      let storage = LogFileStorage(directory: directory)
+      var identity = identityKeystore
+      XCTAssert(storage.flushIdentity(identity))
+      for keystore in keystores {
+        identity.wallets.append(BasicWallet(keystore))
+        identity.walletIds.append(keystore.id)
+        XCTAssert(storage.flushWallet(keystore, identity: identity))
+      }
+      for keystore in keystores {
+        identity.wallets.remove(at: 2)
+        identity.walletIds.remove(at: 2)
+        XCTAssert(storage.removeWallet(keystore.id, identity: identity))
+      }
+      _ = storage.cleanStorage()
+    }
+  }
+
+  private func newKeystores(_ count: Int) -> [Keystore] {
+    var template = try! wallet.loadKeystore().toJSON()
+    return (0..<count).map { _ in
+      template["id"] = UUID().uuidString.lowercased()
+      return try! ETHMnemonicKeystore(json: template)
+    }
+  }
+
+  private func fileSize() -> Int {
+    return (try! FileManager.default.attributesOfItem(atPath: logPath)[.size] as! NSNumber).intValue
+  }
+}
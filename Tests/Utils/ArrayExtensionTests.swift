@@ -0,0 +1,27 @@
+//
+//  ArrayExtensionTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class ArrayExtensionTests: XCTestCase {
+  func testConcurrentMapKeepsOrder() {
+    let input = Array(0..<100)
+    XCTAssertEqual(input.map { $0 * 2 }, try input.tk_concurrentMap { $0 * 2 })
+    XCTAssertEqual([], try [Int]().tk_concurrentMap { $0 })
+  }
+
+  func testConcurrentMapThrows() {
+    XCTAssertThrowsError(try [1, 2, 3].tk_concurrentMap { value -> Int in
+      if value == 2 {
+        throw GenericError.unknownError
+      }
+      return value
+    })
+  }
+}
@@ -7,6 +7,7 @@
 //
 
 import XCTest
+import BigInt
 @testable import TokenCore
 
 class BigNumberTests: XCTestCase {
@@ -28,6 +29,17 @@ class BigNumberTests: XCTestCase {
     XCTAssertEqual("5208", num.description)
   }
 
+  func testParseOddLengthHex() {
+    XCTAssertEqual("1", BigNumber.parse("0x1").description)
+    XCTAssertEqual("01", BigNumber.parse("0x1", padding: true).hexString())
+    XCTAssertEqual("4095", BigNumber.parse("fff").description)
+  }
+
+  func testParseHexOver256Bits() {
+    let hex = "1" + String(repeating: "0", count: 64)
+    XCTAssertEqual(BigUInt(hex, radix: 16)!.description, BigNumber.parse("0x" + hex).description)
+  }
+
   func testParseHexWithoutPrefix() {
     let num = BigNumber.parse("f85f")
     XCTAssertEqual("63583", num.description)
@@ -94,4 +106,16 @@ class BigNumberTests: XCTestCase {
     let num = BigNumber.parse(hex)
     XCTAssertEqual([82, 8], num.serialize())
   }
+
+  func testPaddedHexSerialize() {
+    XCTAssertEqual([0, 0, 0x52, 0x08], BigNumber.parse("0x00005208", padding: true).serialize())
+    XCTAssertEqual([0x52, 0x08], BigNumber.parse("0x00005208").serialize())
+    XCTAssertEqual([0, 0x01], BigNumber.parse("0x001", padding: true).serialize())
+  }
+
+  func testParseBeyond256Bits() {
+    let text = "115792089237316195423570985008687907853269984665640564039457584007913129639936" // 2^256
+    XCTAssertEqual(text, BigNumber.parse(text).description)
+    XCTAssertEqual([1] + [UInt8](repeating: 0, count: 32), BigNumber.parse(text).serialize())
+  }
 }
@@ -48,6 +48,11 @@ class HexTests: XCTestCase {
     XCTAssertFalse("imToken".tk_isHex())
     XCTAssertFalse("12345".tk_isHex())
     XCTAssert("123456".tk_isHex())
+    XCTAssert("0xABCDEF".tk_isHex())
+    XCTAssertFalse("".tk_isHex())
+    XCTAssertFalse("0x".tk_isHex())
+    XCTAssertFalse("0xabcg".tk_isHex())
+    XCTAssertFalse("🤣🤣".tk_isHex())
   }
 
   func testPrefix() {
@@ -78,6 +83,19 @@ class HexTests: XCTestCase {
     XCTAssertEqual(expected, bytes)
   }
 
+  func testToBytesInvalidPair() {
+    XCTAssertEqual([0x12, 0x00, 0x56], Hex.toBytes("12zz56"))
+    XCTAssertEqual([], Hex.toBytes("0x"))
+  }
+
+  func testHexFromBytes() {
+    XCTAssertEqual("", Hex.hex(from: []))
+    XCTAssertEqual("00ff0aa0", Hex.hex(from: [0x00, 0xff, 0x0a, 0xa0]))
+    let bytes = (0...255).map { UInt8($0) }
+    XCTAssertEqual(Hex.toBytes(Hex.hex(from: bytes)), bytes)
+    XCTAssertEqual(Hex.hex(from: bytes), BTCHexFromData(Data(bytes: bytes)))
+  }
+
   func testAnotherString() {
     let hex = "this is a tést".tk_toHexString()
     XCTAssertEqual("7468697320697320612074c3a97374", hex)
@@ -143,9 +161,31 @@ class HexTests: XCTestCase {
     XCTAssertNil("🤣".tk_dataFromHexString())
   }
 
+  func testUppercaseDataFromHexString() {
+    XCTAssertEqual("0xABCDEF".tk_dataFromHexString()?.tk_toHexString(), "abcdef")
+  }
+
   func testReverse() {
     let data = "hello".data(using: .utf8)
     let reversed = data?.tk_toHexString().tk_dataFromHexString()
     XCTAssertEqual(data, reversed)
   }
+
+  func testPerformanceHexCodec32B() {
+    let data = Data.tk_random(of: 32)
+    measure {
+      for _ in 0..<10_000 {
+        _ = data.tk_toHexString().tk_dataFromHexString()
+      }
+    }
+  }
+
+  func testPerformanceHexCodec1MiB() {
+    let data = Data.tk_random(of: 1_048_576)
+    measure {
+      let hex = data.tk_toHexString()
+      _ = Hex.isHex(hex)
+      _ = hex.tk_dataFromHexString()
+    }
+  }
 }
@@ -40,4 +40,54 @@ class RLPTests: XCTestCase {
       XCTAssertEqual(output, encoded, "Encoding \(input)")
     }
   }
+
+  func testTypedList() {
+    let item = RLP.Item.list([.bytes(Array("cat".utf8)), .bytes(Array("dog".utf8))])
+    XCTAssertEqual("c88363617483646f67", Hex.hex(from: RLP.encode(item)))
+  }
+
+  func testDecodeJSONFixture() {
+    let json = TestHelper.loadJSON(filename: "rlp")
+    let data = json.data(using: .utf8)!
+    let jsonObject = try! JSONSerialization.jsonObject(with: data) as! [String: Any]
+    for (name, testPair) in jsonObject {
+      let output = (testPair as! [String: Any])["out"] as! String
+      let bytes = Hex.toBytes(output)
+      let decoded = try! RLP.decode(bytes)
+      XCTAssertEqual(bytes, RLP.encode(item(from: decoded)), "Decoding \(name)")
+    }
+  }
+
+  func testDecodeSlicesInput() {
+    let bytes = Hex.toBytes("c88363617483646f67")
+    guard case .list(let items) = try! RLP.decode(bytes), case .bytes(let dog) = items[1] else {
+      return XCTFail("Expected list")
+    }
+    XCTAssertEqual(Array("dog".utf8), Array(dog))
+    XCTAssertEqual(6..<9, dog.indices)
+  }
+
+  func testDecodeInvalid() {
+    let invalids = [
+      "",
+      "8100", // single byte below 0x80 must not be prefixed
+      "83646f", // payload shorter than length
+      "b800", // long form for short length
+      "b90039", // length with leading zero
+      "c883636174", // list payload shorter than length
+      "808080" // trailing bytes
+    ]
+    for invalid in invalids {
+      XCTAssertThrowsError(try RLP.decode(Hex.toBytes(invalid)), invalid)
+    }
+  }
+
+  private func item(from decoded: RLP.Decoded) -> RLP.Item {
+    switch decoded {
+    case .bytes(let bytes):
+      return .bytes(Array(bytes))
+    case .list(let items):
+      return .list(items.map { item(from: $0) })
+    }
+  }
 }
@@ -65,6 +65,72 @@ class SigUtilTests: XCTestCase {
     let sign = SigUtil.concatSig(v: ecsign["v"] as! Int32, r: ecsign["r"] as! String, s: ecsign["s"] as! String).add0xIfNeeded()
     let (sig, recId) = try! SigUtil.unpackSig(sig: sign.removePrefix0xIfNeeded())
     let pub = SigUtil.ecrecover(signature: sig, recid: recId, forHash: "49".keccak256())!.tk_dataFromHexString()!
-    XCTAssertEqual(ETHKey.pubToAddress(pub), ETHKey(privateKey: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1").address)
+    XCTAssertEqual(ETHKey.pubToAddress(pub), ETHKey(privateKey: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1")!.address)
+  }
+
+  func testBatchPersonalSign() {
+    let fixture = signatureFixtures[0]
+    let message = String(data: fixture["message"]!.tk_dataFromHexString()!, encoding: .utf8)!
+    let packed = SigUtil.batchPersonalSign(privateKey: fixture["privateKey"]!, messages: [message, message], concurrently: false)!
+    XCTAssertEqual(130, packed.count)
+    XCTAssertEqual(fixture["signature"], Hex.hex(from: Array(packed[0..<65])))
+    XCTAssertEqual(fixture["signature"], Hex.hex(from: Array(packed[65..<130])))
+  }
+
+  func testBatchEcsignPackedMatchesEcsign() {
+    let privateKey = "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1"
+    let hashes = (0..<100).map { String($0).keccak256() }
+    let expected = SigUtil.batchEcsign(with: privateKey, data: hashes).map { result in
+      SigUtil.concatSig(v: result["v"] as! Int32, r: result["r"] as! String, s: result["s"] as! String)
+    }
+    XCTAssertEqual(expected[49], SigUtil.concatSig(v: 28, r: "282cb1fc266b030ddd000a3afd56396b823e836f635873668f1836d8fe080a29", s: "00c4115fd7f8f17e035a53893625a0fe8debfb805ccd5ee209285fb6471809aa"))
+
+    let hashBytes = hashes.flatMap { Hex.toBytes($0) }
+    for concurrently in [false, true] {
+      let packed = SigUtil.batchEcsign(with: privateKey, hashes: hashBytes, concurrently: concurrently)!
+      let actual = (0..<hashes.count).map { Hex.hex(from: Array(packed[($0 * 65)..<($0 * 65 + 65)])) }
+      XCTAssertEqual(expected, actual)
+    }
+  }
+
+  func testBatchEcsignInvalid() {
+    XCTAssertNil(SigUtil.batchEcsign(with: "00", hashes: [UInt8](repeating: 1, count: 32)))
+    XCTAssertNil(SigUtil.batchEcsign(with: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1", hashes: [1, 2, 3]))
+    XCTAssertEqual([], SigUtil.batchEcsign(with: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1", hashes: [])!)
+  }
+
+  func testPerformanceBatchEcsign() {
+    let hashBytes = (0..<1_000).flatMap { Hex.toBytes(String($0).keccak256()) }
+    measure {
+      _ = SigUtil.batchEcsign(with: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1", hashes: hashBytes)
+    }
+  }
+
+  func testBatchRecoverAndVerify() {
+    let privateKey = "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1"
+    let address = ETHKey(privateKey: privateKey)!.address
+    let hashBytes = (0..<100).flatMap { Hex.toBytes(String($0).keccak256()) }
+    var signatures = SigUtil.batchEcsign(with: privateKey, hashes: hashBytes)!
+
+    let addresses = SigUtil.batchRecoverAddresses(hashes: hashBytes, signatures: signatures)!
+    XCTAssertEqual(100, addresses.count)
+    XCTAssert(addresses.filter { $0 != address }.isEmpty)
+    XCTAssertEqual(ETHKey.pubToAddress(Data(bytes: Array(SigUtil.batchEcrecover(hashes: hashBytes, signatures: signatures)![0..<65]))), address)
+
+    // Tamper with s of the second signature
+    signatures[65 + 40] ^= 0xff
+    let verified = SigUtil.batchVerify(hashes: hashBytes, signatures: signatures, addresses: Array(repeating: address.add0xIfNeeded(), count: 100))
+    XCTAssertEqual([true, false, true], Array(verified.prefix(3)))
+    XCTAssertEqual(99, verified.filter { $0 }.count)
+
+    XCTAssertEqual([false], SigUtil.batchVerify(hashes: [1], signatures: signatures, addresses: [address]))
+  }
+
+  func testPerformanceBatchRecoverAddresses() {
+    let hashBytes = (0..<1_000).flatMap { Hex.toBytes(String($0).keccak256()) }
+    let signatures = SigUtil.batchEcsign(with: "3c9229289a6125f7fdf1885a77bb12c37a8d3b4962d936f7e3084dece32a3ca1", hashes: hashBytes)!
+    measure {
+      _ = SigUtil.batchRecoverAddresses(hashes: hashBytes, signatures: signatures)
+    }
   }
 }
@@ -0,0 +1,56 @@
+//
+//  UInt256Tests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+import BigInt
+@testable import TokenCore
+
+class UInt256Tests: XCTestCase {
+  func testParseDecimal() {
+    XCTAssertEqual([], UInt256(decimal: "0")!.serialize())
+    XCTAssertEqual([0x52, 0x08], UInt256(decimal: "21000")!.serialize())
+    XCTAssertEqual([0x0d, 0xe0, 0xb6, 0xb3, 0xa7, 0x64, 0x00, 0x00], UInt256(decimal: "1000000000000000000")!.serialize())
+    XCTAssertEqual([UInt8](repeating: 0xff, count: 32), UInt256(decimal: "115792089237316195423570985008687907853269984665640564039457584007913129639935")!.serialize())
+  }
+
+  func testParseDecimalMatchesBigUInt() {
+    let texts = ["1", "18446744073709551615", "18446744073709551616", "83729609699884896815286331701780722", "340282366920938463463374607431768211456"]
+    for text in texts {
+      XCTAssertEqual(BigUInt(text, radix: 10)!.serialize().bytes, UInt256(decimal: text)!.serialize())
+    }
+  }
+
+  func testParseDecimalInvalid() {
+    XCTAssertNil(UInt256(decimal: ""))
+    XCTAssertNil(UInt256(decimal: "12a"))
+    XCTAssertNil(UInt256(decimal: "-1"))
+    XCTAssertNil(UInt256(decimal: "115792089237316195423570985008687907853269984665640564039457584007913129639936"))
+  }
+
+  func testParseHex() {
+    XCTAssertEqual(UInt256(21000), UInt256(hex: "0x5208"))
+    XCTAssertEqual(UInt256(21000), UInt256(hex: "0000005208"))
+    XCTAssertEqual([0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00], UInt256(hex: "10000000000000000")!.serialize())
+    XCTAssertEqual([UInt8](repeating: 0xff, count: 32), UInt256(hex: String(repeating: "F", count: 64))!.serialize())
+    XCTAssertEqual(UInt256(), UInt256(hex: "0x0"))
+  }
+
+  func testParseHexInvalid() {
+    XCTAssertNil(UInt256(hex: "0x"))
+    XCTAssertNil(UInt256(hex: "0x5g"))
+    XCTAssertNil(UInt256(hex: "1" + String(repeating: "0", count: 64)))
+  }
+
+  func testPerformanceParseAndSerialize() {
+    measure {
+      for i in 0..<10_000 {
+        _ = UInt256(decimal: "1000000000000000000\(i)")?.serialize()
+      }
+    }
+  }
+}
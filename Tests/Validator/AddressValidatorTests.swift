@@ -53,4 +53,25 @@ class AddressValidatorTests: TestCase {
     XCTAssertFalse(validator.isValid)
     XCTAssertThrowsError(try validator.validate())
   }
+
+  func testValidateAddresses() {
+    let addresses = [
+      "0xF308646bd9e6808ca7BE41E3e580f8E7196C5573",
+      "0xf308646bd9e6808ca7be41e3e580f8e7196c5573",
+      "0XF308646BD9E6808CA7BE41E3E580F8E7196C5573",
+      "F308646BD9E6808CA7BE41E3E580F8E7196C5573",
+      "F308646bd9e6808ca7BE41E3e580f8E7196C5573",
+      "0xf308646bd9e6808ca7BE41E3e580f8E7196C5573",
+      "0xF308646bd9e6808ca7BE41E3e580f8E7196C557G",
+      "0x"
+    ]
+    XCTAssertEqual([true, true, true, true, false, false, false, false], AddressValidator.isValid(addresses: addresses))
+  }
+
+  func testPerformanceValidateAddresses() {
+    let addresses = Array(repeating: "0xF308646bd9e6808ca7BE41E3e580f8E7196C5573", count: 10_000)
+    measure {
+      _ = AddressValidator.isValid(addresses: addresses)
+    }
+  }
 }
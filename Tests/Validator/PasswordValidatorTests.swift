@@ -55,4 +55,10 @@ class PasswordValidatorTests: TestCase {
     XCTAssertFalse(validator.isValid)
     XCTAssertThrowsError(try validator.validate())
   }
+
+  func testLineTerminator() {
+    XCTAssertFalse(PasswordValidator("1234\n!@#$").isFormatValid)
+    XCTAssert(PasswordValidator("密码密码密码密码").isFormatValid)
+    XCTAssertFalse(PasswordValidator("密码密码密码密").isFormatValid)
+  }
 }
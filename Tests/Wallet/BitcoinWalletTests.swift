@@ -37,7 +37,7 @@ class BitcoinWalletTests: TestCase {
       let identity = Identity.currentIdentity!
       let metadata = WalletMeta(chain: .btc, source: .wif)
       let wallet = try identity.importFromPrivateKey(TestData.wif, encryptedBy: TestData.password, metadata: metadata)
-      XCTAssertMapEqual(expectedResult, wallet.serializeToMap())
+      XCTAssertMapEqual(expectedResult, try! wallet.serializeToMap())
       XCTAssertEqual(TestData.wif, try wallet.privateKey(password: TestData.password))
 
       do {
@@ -65,7 +65,7 @@ class BitcoinWalletTests: TestCase {
       let metadata = WalletMeta(chain: .btc, source: .mnemonic)
       let identity = Identity.currentIdentity!
       let wallet = try identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.btcMainnet)
-      XCTAssertMapEqual(expectedResult, wallet.serializeToMap())
+      XCTAssertMapEqual(expectedResult, try! wallet.serializeToMap())
       XCTAssertEqual(TestData.mnemonic, try wallet.exportMnemonic(password: TestData.password), "Mnemonic should be equal")
       XCTAssertEqual(TestData.xprv, try wallet.privateKey(password: TestData.password), "XPrv should be euqal")
     } catch {
@@ -21,7 +21,7 @@ class EthereumWalletTests: TestCase {
       let identity = Identity.currentIdentity!
       let metadata = WalletMeta(chain: .eth, source: .privateKey)
       let wallet = try identity.importFromPrivateKey(TestData.privateKey, encryptedBy: TestData.password, metadata: metadata)
-      XCTAssertMapEqual(expectedResult, wallet.keystore.serializeToMap())
+      XCTAssertMapEqual(expectedResult, try! wallet.loadKeystore().serializeToMap())
       XCTAssertEqual(TestData.privateKey, try wallet.privateKey(password: TestData.password), "private decrypted from keystore should be right")
     } catch {
       XCTFail("import wallet from private key failed: \(error)")
@@ -39,7 +39,7 @@ class EthereumWalletTests: TestCase {
       let identity = Identity.currentIdentity!
 
       let wallet = try identity.importFromMnemonic(TestData.mnemonic, metadata: metadata, encryptBy: TestData.password, at: BIP44.eth)
-      XCTAssertMapEqual(expectedResult, wallet.keystore.serializeToMap())
+      XCTAssertMapEqual(expectedResult, try! wallet.loadKeystore().serializeToMap())
       XCTAssertEqual(TestData.mnemonic, try wallet.exportMnemonic(password: TestData.password), "mnemonic decrypted from keystore should be right")
       XCTAssertEqual(TestData.privateKey, try wallet.privateKey(password: TestData.password), "private decrypted from keystore should be right")
     } catch {
@@ -59,6 +59,6 @@ class EthereumWalletTests: TestCase {
     let metadata = WalletMeta(chain: .eth, source: .keystore)
     let identity =  Identity.currentIdentity!
     let wallet = try! identity.importFromKeystore(keystore, encryptedBy: "testpassword", metadata: metadata)
-    XCTAssertMapEqual(expectedResult, wallet.keystore.serializeToMap())
+    XCTAssertMapEqual(expectedResult, try! wallet.loadKeystore().serializeToMap())
   }
 }
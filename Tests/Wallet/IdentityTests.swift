@@ -49,11 +49,11 @@ class IdentityTests: TestCase {
       
       let btcWallet = identity.keystore.wallets[1]
 
-      XCTAssertEqual(btcWallet.keystore.address, "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN")
+      XCTAssertEqual(try! btcWallet.loadKeystore().address, "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN")
       XCTAssertEqual(try! btcWallet.calcExternalAddress(at: 1), "mj78AbVtQ9SWnvbU7pcrueyE1krMmZtoUU")
       let expectedXPrv = "tprv8g8UWPRHxaNWXZN3uoaiNpyYyaDr2j5Dvcj1vxLxKcEF653k7xcN9wq9eT73wBM1HzE9hmWJbAPXvDvaMXqGWm81UcVpHnmATfH2JJrfhGg"
       XCTAssertEqual(expectedXPrv, try btcWallet.privateKey(password: TestData.password))
-      XCTAssertEqual((btcWallet.keystore as! BTCMnemonicKeystore).getEncryptedXPub(), "z8mGJW10fGNvS5y4u5NJB2InBghTty10hbgM0EzPksr91LUDZqnbX8vINytLWeEqBW7knUNo9+SvDSAFi+gNEEmUUYzvsYYBfieuo6pANe8s/hHnrbqfL/PN9xtvIl57ZO5hMN3AMCX/NzSd8+WIQw==")
+      XCTAssertEqual((try! btcWallet.loadKeystore() as! BTCMnemonicKeystore).getEncryptedXPub(), "z8mGJW10fGNvS5y4u5NJB2InBghTty10hbgM0EzPksr91LUDZqnbX8vINytLWeEqBW7knUNo9+SvDSAFi+gNEEmUUYzvsYYBfieuo6pANe8s/hHnrbqfL/PN9xtvIl57ZO5hMN3AMCX/NzSd8+WIQw==")
     } catch {
       XCTFail("create recover identity \(error)")
     }
@@ -104,6 +104,133 @@ class IdentityTests: TestCase {
     XCTAssertFalse(identity.removeWallet(wallet))
   }
 
+  func testFindWalletByAddress() {
+    let identity = Identity.currentIdentity!
+    let ethWallet = identity.wallets[0]
+    XCTAssert(identity.findWalletByAddress(ethWallet.address.uppercased().add0xIfNeeded(), on: .eth) === ethWallet)
+    XCTAssertNil(identity.findWalletByAddress(ethWallet.address, on: .btc))
+
+    let btcWallet = identity.wallets[1]
+    XCTAssert(identity.findWalletByWalletID(btcWallet.walletID) === btcWallet)
+    XCTAssertNil(identity.findWalletByAddress(btcWallet.address.lowercased(), on: .btc))
+  }
+
+  func testIndexesFollowWalletChanges() {
+    let identity = Identity.currentIdentity!
+    let wallet = try! identity.importFromPrivateKey(TestData.privateKey, encryptedBy: TestData.password, metadata: WalletMeta(chain: .eth, source: .privateKey))
+    XCTAssert(identity.findWalletByWalletID(wallet.walletID) === wallet)
+    XCTAssert(identity.findWalletByAddress(wallet.address, on: .eth) === wallet)
+
+    XCTAssert(identity.removeWallet(wallet))
+    XCTAssertNil(identity.findWalletByWalletID(wallet.walletID))
+    XCTAssertNil(identity.findWalletByAddress(wallet.address, on: .eth))
+
+    let btcWallet = identity.wallets[1]
+    let oldAddress = btcWallet.address
+    let segWit: SegWit = btcWallet.imTokenMeta.isSegWit ? .none : .p2wpkh
+    _ = try! WalletManager.switchBTCWalletMode(walletID: btcWallet.walletID, password: TestData.password, segWit: segWit)
+    XCTAssertNotEqual(oldAddress, btcWallet.address)
+    XCTAssertNil(identity.findWalletByAddress(oldAddress, on: .btc))
+    XCTAssert(identity.findWalletByAddress(btcWallet.address, on: .btc) === btcWallet)
+  }
+
+  func testLazyLoadWallets() {
+    let identity = Identity.currentIdentity!
+    let json = try! identity.keystore.dump().tk_toJSON()
+
+    let loaded = Identity(json: json)!
+    XCTAssertEqual(identity.wallets.map { $0.walletID }, loaded.wallets.map { $0.walletID })
+    XCTAssertEqual(identity.wallets.map { $0.address }, loaded.wallets.map { $0.address })
+    XCTAssertNotNil(loaded.findWalletByAddress(identity.wallets[0].address, on: .eth))
+    XCTAssertFalse(loaded.wallets.contains { $0.isKeystoreLoaded })
+
+    XCTAssertEqual(identity.wallets[1].imTokenMeta.segWit, loaded.wallets[1].imTokenMeta.segWit)
+    XCTAssertFalse(loaded.wallets[1].isKeystoreLoaded)
+    XCTAssertEqual(identity.wallets[1].address, try! loaded.wallets[1].loadKeystore().address)
+    XCTAssert(loaded.wallets[1].isKeystoreLoaded)
+    XCTAssertFalse(loaded.wallets[0].isKeystoreLoaded)
+  }
+
+  func testLoadWithMissingWalletKeystore() {
+    let identity = Identity.currentIdentity!
+    let missing = identity.wallets[1]
+    XCTAssert(Identity.storage.deleteWalletByID(missing.walletID))
+
+    let loaded = Identity.storage.tryLoadIdentity()!
+    XCTAssertEqual(identity.wallets.map { $0.walletID }, loaded.wallets.map { $0.walletID })
+    XCTAssertEqual(missing.address, loaded.wallets[1].address)
+    XCTAssertThrowsError(try loaded.wallets[1].loadKeystore()) { error in
+      XCTAssertEqual(GenericError.walletNotFound, error as? GenericError)
+    }
+    XCTAssertFalse(loaded.wallets[1].verifyPassword(TestData.password))
+    XCTAssertNotNil(try? loaded.wallets[0].loadKeystore())
+    XCTAssertEqual(1, (loaded.keystore.serializeToMap()["wallets"] as! [JSONObject]).count)
+
+    Identity.currentIdentity = loaded
+    XCTAssertThrowsError(try WalletManager.exportKeystore(walletID: missing.walletID, password: TestData.password)) { error in
+      XCTAssertEqual(GenericError.walletNotFound, error as? GenericError)
+    }
+  }
+
+  func testLoadWalletsWithoutIndex() {
+    let identity = Identity.currentIdentity!
+    var json = try! identity.keystore.dump().tk_toJSON()
+    json.removeValue(forKey: "walletIndex")
+
+    let loaded = Identity(json: json)!
+    XCTAssertEqual(identity.wallets.map { $0.address }, loaded.wallets.map { $0.address })
+    XCTAssertFalse(loaded.wallets.contains { !$0.isKeystoreLoaded })
+  }
+
+  func testPerformanceColdStart1k() {
+    let json = identityJSON(walletCount: 1_000)
+    measure {
+      _ = Identity(json: json)
+    }
+  }
+
+  func testPerformanceColdStart10k() {
+    let json = identityJSON(walletCount: 10_000)
+    measure {
+      _ = Identity(json: json)
+    }
+  }
+
+  func testPerformanceColdStartWithoutIndex1k() {
+    var json = identityJSON(walletCount: 1_000)
+    json.removeValue(forKey: "walletIndex")
+    measure {
+      _ = Identity(json: json)
+    }
+  }
+
+  func testPerformanceFindWallet10k() {
+    let identity = Identity(json: identityJSON(walletCount: 10_000))!
+    let walletIDs = identity.wallets.map { $0.walletID }
+    let address = identity.wallets[0].address
+    measure {
+      for walletID in walletIDs {
+        XCTAssertNotNil(identity.findWalletByWalletID(walletID))
+        XCTAssertNotNil(identity.findWalletByAddress(address, on: .eth))
+      }
+    }
+  }
+
+  /// Identity JSON listing walletCount stored copies of the ETH wallet.
+  private func identityJSON(walletCount: Int) -> JSONObject {
+    let identity = Identity.currentIdentity!
+    var keystore = identity.keystore
+    var template = try! identity.wallets[0].loadKeystore().toJSON()
+    for _ in 0..<walletCount {
+      template["id"] = UUID().uuidString.lowercased()
+      let wallet = try! BasicWallet(json: template)
+      _ = Identity.storage.flushWallet(try! wallet.loadKeystore())
+      keystore.wallets.append(wallet)
+      keystore.walletIds.append(wallet.walletID)
+    }
+    return try! keystore.dump().tk_toJSON()
+  }
+
   func testIPFSDecrypt() {
     var metadata = WalletMeta(source: .recoveredIdentity)
     metadata.network = .testnet
@@ -0,0 +1,127 @@
+//
+//  SigningExecutorTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+@testable import TokenCore
+
+class SigningExecutorTests: TestCase {
+  func testAsyncSignMatchesSync() {
+    let walletID = Identity.currentIdentity!.wallets[0].walletID
+    let expected = try! WalletManager.ethSignTransaction(walletID: walletID, nonce: "65", gasPrice: "20000000000", gasLimit: "21000", to: "3535353535353535353535353535353535353535", value: "1000000000000000000", data: "", password: TestData.password, chainID: 1)
+
+    let signed = expectation(description: "signed")
+    WalletManager.ethSignTransaction(walletID: walletID, nonce: "65", gasPrice: "20000000000", gasLimit: "21000", to: "3535353535353535353535353535353535353535", value: "1000000000000000000", data: "", password: TestData.password, chainID: 1, priority: .high) { result, error in
+      XCTAssert(Thread.isMainThread)
+      XCTAssertNil(error)
+      XCTAssertEqual(expected.signedTx, result?.signedTx)
+      signed.fulfill()
+    }
+    waitForExpectations(timeout: 10)
+  }
+
+  /// BTC, EOS transaction and EOS message signing all on the shared executor at once, each matching its known signature.
+  func testAsyncBTCAndEOSSignConcurrently() {
+    let btcWallet = try! WalletManager.importFromMnemonic(TestData.mnemonic, metadata: WalletMeta(chain: .btc, source: .mnemonic, network: .testnet), encryptBy: TestData.password, at: BIP44.btcTestnet)
+    let eosWallet = try! WalletManager.importEOS(from: TestData.mnemonic, accountName: "", permissions: [], metadata: WalletMeta(chain: .eos, source: .mnemonic), encryptBy: TestData.password, at: BIP44.eosLedger)
+    let eosLegacyWallet = try! WalletManager.importFromPrivateKey(TestData.eosPrivateKey, encryptedBy: TestData.password, metadata: WalletMeta(chain: .eos, source: .wif), accountName: "imtoken1")
+    let outputs: [[String: Any]] = [
+      ["txHash": "983adf9d813a2b8057454cc6f36c6081948af849966f9b9a33e5b653b02f227a", "vout": 0, "amount": "200000000", "address": "mh7jj2ELSQUvRQELbn9qyA4q5nADhmJmUC", "scriptPubKey": "76a914118c3123196e030a8a607c22bafc1577af61497d88ac", "derivedPath": "0/22"],
+      ["txHash": "45ef8ac7f78b3d7d5ce71ae7934aea02f4ece1af458773f12af8ca4d79a9b531", "vout": 1, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"],
+      ["txHash": "14c67e92611dc33df31887bbc468fbbb6df4b77f551071d888a195d1df402ca9", "vout": 0, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"],
+      ["txHash": "117fb6b85ded92e87ee3b599fb0468f13aa0c24b4a442a0d334fb184883e9ab9", "vout": 1, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"]
+    ]
+    let expectedBTC = try! WalletManager.btcSignTransaction(walletID: btcWallet.walletID, to: "moLK3tBG86ifpDDTqAQzs4a9cUoNjVLRE3", amount: 750000000, fee: 502130, password: TestData.password, outputs: outputs, changeIdx: 53, isTestnet: true, segWit: .none).signedTx
+    let txs = [
+      EOSTransaction(
+        data: "c578065b93aec6a7c811000000000100a6823403ea3055000000572d3ccdcd01000000602a48b37400000000a8ed323225000000602a48b374208410425c95b1ca80969800000000000453595300000000046d656d6f00",
+        publicKeys: ["EOS88XhiiP7Cu5TmAUJqHbyuhyYgd6sei68AU266PyetDDAtjmYWF"],
+        chainID: TestData.eosChainID
+      )
+    ]
+    let expectedEOS = EOSSignResult(hash: "6af5b3ae9871c25e2de195168ed7423f455a68330955701e327f02276bb34088", signs: ["SIG_K1_KjZXm86HMVyUd59E15pCkrpn5uUPAAsjTxjEVRRueEvGciinxRS3sATmEEWdkb8hRNHhf6SXofsz4qzPdD6mfZ67FoqLxh"])
+    let expectedEcSign = "SIG_K1_JuVsfsNmB3JgvsnxUcmuw5m27gH9xTGuU4yN9BMoRLeLVYhA4Bfypdm8DDg5cUTXSLArDLc3gtRFkFHMm3rmZyZxD5FE7k"
+
+    let rounds = 8
+    let signed = expectation(description: "signed")
+    signed.expectedFulfillmentCount = rounds * 3
+    for _ in 0..<rounds {
+      WalletManager.btcSignTransaction(walletID: btcWallet.walletID, to: "moLK3tBG86ifpDDTqAQzs4a9cUoNjVLRE3", amount: 750000000, fee: 502130, password: TestData.password, outputs: outputs, changeIdx: 53, isTestnet: true, segWit: .none) { result, error in
+        XCTAssertNil(error)
+        XCTAssertEqual(expectedBTC, result?.signedTx)
+        signed.fulfill()
+      }
+      WalletManager.eosSignTransaction(walletID: eosWallet.walletID, txs: txs, password: TestData.password) { result, error in
+        XCTAssertNil(error)
+        XCTAssertEqual([expectedEOS], result ?? [])
+        signed.fulfill()
+      }
+      WalletManager.eosEcSign(walletID: eosLegacyWallet.walletID, data: "imToken2017", isHex: false, publicKey: TestData.eosPublicKey, password: TestData.password) { result, error in
+        XCTAssertNil(error)
+        XCTAssertEqual(expectedEcSign, result)
+        signed.fulfill()
+      }
+    }
+    waitForExpectations(timeout: 60)
+  }
+
+  func testAsyncErrorIsDelivered() {
+    let failed = expectation(description: "failed")
+    WalletManager.exportPrivateKey(walletID: Identity.currentIdentity!.wallets[0].walletID, password: TestData.wrongPassword) { result, error in
+      XCTAssertNil(result)
+      XCTAssertEqual(PasswordError.incorrect, error as? PasswordError)
+      failed.fulfill()
+    }
+    waitForExpectations(timeout: 10)
+  }
+
+  func testCancelPendingTask() {
+    let executor = SigningExecutor(maxConcurrentTasks: 1)
+    let blocker = DispatchSemaphore(value: 0)
+    let first = expectation(description: "first")
+    let second = expectation(description: "second")
+
+    executor.submit(work: { () -> Int in
+      blocker.wait()
+      return 1
+    }, completion: { result, _ in
+      XCTAssertEqual(1, result)
+      first.fulfill()
+    })
+    let task = executor.submit(work: { 2 }, completion: { result, error in
+      XCTAssertNil(result)
+      XCTAssertEqual(GenericError.operationCancelled, error as? GenericError)
+      second.fulfill()
+    })
+    task.cancel()
+    XCTAssert(task.isCancelled)
+    blocker.signal()
+    waitForExpectations(timeout: 10)
+
+    XCTAssertEqual(1, executor.metrics.completedCount)
+    XCTAssertEqual(1, executor.metrics.cancelledCount)
+  }
+
+  func testMetrics() {
+    let executor = SigningExecutor()
+    let done = expectation(description: "done")
+    done.expectedFulfillmentCount = 4
+    for _ in 0..<4 {
+      executor.submit(work: { usleep(10_000) }, completion: { _, _ in done.fulfill() })
+    }
+    waitForExpectations(timeout: 10)
+
+    let metrics = executor.metrics
+    XCTAssertEqual(4, metrics.completedCount)
+    XCTAssertEqual(0, metrics.cancelledCount)
+    XCTAssert(metrics.averageExecutionTime >= 0.01)
+    XCTAssert(metrics.maxExecutionTime >= metrics.averageExecutionTime)
+
+    executor.resetMetrics()
+    XCTAssertEqual(0, executor.metrics.completedCount)
+  }
+}
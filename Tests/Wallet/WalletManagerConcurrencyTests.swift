@@ -0,0 +1,130 @@
+//
+//  WalletManagerConcurrencyTests.swift
+//  TokenCoreTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 ConsenLabs. All rights reserved.
+//
+
+import XCTest
+import CoreBitcoin
+@testable import TokenCore
+
+class WalletManagerConcurrencyTests: TestCase {
+  private let iterations = 256
+
+  override func tearDown() {
+    UnlockSessionCache.isEnabled = false
+    super.tearDown()
+  }
+
+  func testSignConcurrently() {
+    stressSigning()
+  }
+
+  func testSignConcurrentlyWithUnlockSession() {
+    UnlockSessionCache.isEnabled = true
+    stressSigning()
+  }
+
+  func testSwitchBTCWalletModeConcurrently() {
+    let wallet = Identity.currentIdentity!.wallets[1]
+    var failures = 0
+    let failuresLock = NSLock()
+
+    DispatchQueue.concurrentPerform(iterations: 16) { i in
+      do {
+        _ = try WalletManager.switchBTCWalletMode(walletID: wallet.walletID, password: TestData.password, segWit: i % 2 == 0 ? .p2wpkh : .none)
+      } catch {
+        failuresLock.lock()
+        failures += 1
+        failuresLock.unlock()
+      }
+    }
+
+    XCTAssertEqual(0, failures)
+    XCTAssert(try WalletManager.findWalletByAddress(wallet.address, on: .btc) === wallet)
+  }
+
+  /// ETH and BTC signing, lookups, imports and removals all at once on one identity.
+  private func stressSigning() {
+    let identity = Identity.currentIdentity!
+    let wallet = identity.wallets[0]
+    let btcWallet = try! identity.importFromMnemonic(TestData.mnemonic, metadata: WalletMeta(chain: .btc, source: .mnemonic, network: .testnet), encryptBy: TestData.password, at: BIP44.btcTestnet)
+    let walletCount = identity.wallets.count
+    let expected = try! sign(walletID: wallet.walletID).signedTx
+    let expectedBTC = try! signBTC(walletID: btcWallet.walletID).signedTx
+    var failures = [String]()
+    let failuresLock = NSLock()
+    func fail(_ message: String) {
+      failuresLock.lock()
+      failures.append(message)
+      failuresLock.unlock()
+    }
+
+    DispatchQueue.concurrentPerform(iterations: iterations) { i in
+      do {
+        switch i % 6 {
+        case 0, 1:
+          if try sign(walletID: wallet.walletID).signedTx != expected {
+            fail("signature \(i) differs")
+          }
+        case 2:
+          if try signBTC(walletID: btcWallet.walletID).signedTx != expectedBTC {
+            fail("BTC signature \(i) differs")
+          }
+        case 3:
+          if identity.findWalletByAddress(wallet.address, on: .eth) !== wallet || identity.findWalletByWalletID(wallet.walletID) !== wallet {
+            fail("lookup \(i) missed")
+          }
+        case 4:
+          let privateKey = String(format: "%064x", i + 1)
+          let imported = try identity.importFromPrivateKey(privateKey, encryptedBy: TestData.password, metadata: WalletMeta(chain: .eth, source: .privateKey))
+          if !identity.removeWallet(imported) {
+            fail("removal \(i) failed")
+          }
+        default:
+          let key = BTCKey(privateKey: String(format: "%064x", i + 1).tk_dataFromHexString())!
+          key.isPublicKeyCompressed = true
+          let imported = try identity.importFromPrivateKey(key.wif, encryptedBy: TestData.password, metadata: WalletMeta(chain: .btc, source: .wif, network: .mainnet))
+          if try identity.findWalletByPrivateKey(key.wif, on: .btc, network: .mainnet) !== imported {
+            fail("BTC lookup \(i) missed")
+          }
+          if !identity.removeWallet(imported) {
+            fail("BTC removal \(i) failed")
+          }
+        }
+      } catch {
+        fail("\(i): \(error)")
+      }
+    }
+
+    XCTAssertEqual([], failures)
+    XCTAssertEqual(walletCount, identity.wallets.count)
+  }
+
+  private func sign(walletID: String) throws -> TransactionSignedResult {
+    return try WalletManager.ethSignTransaction(
+      walletID: walletID,
+      nonce: "65",
+      gasPrice: "20000000000",
+      gasLimit: "21000",
+      to: "3535353535353535353535353535353535353535",
+      value: "1000000000000000000",
+      data: "",
+      password: TestData.password,
+      chainID: 1
+    )
+  }
+
+  /// Four P2PKH inputs of the testnet mnemonic wallet, as BTCTransactionSignerTests.testSignTransactionMultipleUTXO.
+  private func signBTC(walletID: String) throws -> TransactionSignedResult {
+    let outputs: [[String: Any]] = [
+      ["txHash": "983adf9d813a2b8057454cc6f36c6081948af849966f9b9a33e5b653b02f227a", "vout": 0, "amount": "200000000", "address": "mh7jj2ELSQUvRQELbn9qyA4q5nADhmJmUC", "scriptPubKey": "76a914118c3123196e030a8a607c22bafc1577af61497d88ac", "derivedPath": "0/22"],
+      ["txHash": "45ef8ac7f78b3d7d5ce71ae7934aea02f4ece1af458773f12af8ca4d79a9b531", "vout": 1, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"],
+      ["txHash": "14c67e92611dc33df31887bbc468fbbb6df4b77f551071d888a195d1df402ca9", "vout": 0, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"],
+      ["txHash": "117fb6b85ded92e87ee3b599fb0468f13aa0c24b4a442a0d334fb184883e9ab9", "vout": 1, "amount": "200000000", "address": "mkeNU5nVnozJiaACDELLCsVUc8Wxoh1rQN", "scriptPubKey": "76a914383fb81cb0a3fc724b5e08cf8bbd404336d711f688ac", "derivedPath": "0/0"]
+    ]
+    return try WalletManager.btcSignTransaction(walletID: walletID, to: "moLK3tBG86ifpDDTqAQzs4a9cUoNjVLRE3", amount: 750000000, fee: 502130, password: TestData.password, outputs: outputs, changeIdx: 53, isTestnet: true, segWit: .none)
+  }
+}
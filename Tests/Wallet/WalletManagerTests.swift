@@ -65,10 +65,10 @@ class WalletManagerTests: TestCase {
       var meta = WalletMeta(chain: .btc, source: .mnemonic)
       meta.segWit = .p2wpkh
       let wallet = try WalletManager.importFromMnemonic(mnemonic, metadata: meta, encryptBy: TestData.password, at: BIP44.btcMainnet)
-      XCTAssert((wallet.keystore as! BTCMnemonicKeystore).meta.isSegWit)
+      XCTAssert((try! wallet.loadKeystore() as! BTCMnemonicKeystore).meta.isSegWit)
       _ = try WalletManager.switchBTCWalletMode(walletID: wallet.walletID, password: TestData.password, segWit: .none)
       let loadedWallet = try! WalletManager.findWalletByAddress(wallet.address, on: .btc)
-      XCTAssertFalse((loadedWallet.keystore as! BTCMnemonicKeystore).meta.isSegWit)
+      XCTAssertFalse((try! loadedWallet.loadKeystore() as! BTCMnemonicKeystore).meta.isSegWit)
     } catch {
       XCTFail("fail caused by \(error)")
     }